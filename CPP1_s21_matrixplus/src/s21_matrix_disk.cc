@@ -0,0 +1,203 @@
+#include "s21_matrix_disk.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <future>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+constexpr std::streamoff kHeaderSize = 2 * sizeof(std::int64_t);
+
+struct TileStep {
+  int row, col, inner;
+};
+
+struct TilePair {
+  std::vector<double> a, b;
+};
+
+}  // namespace
+
+S21DiskMatrix::S21DiskMatrix(const std::string& path, int rows, int cols)
+    : path_(path), rows_(rows), cols_(cols) {
+  if (rows < 1 || cols < 1) {
+    throw std::invalid_argument("Invalid number of columns or rows");
+  }
+  {
+    std::ofstream out(path_, std::ios::binary | std::ios::trunc);
+    std::int64_t header[2] = {rows_, cols_};
+    out.write(reinterpret_cast<const char*>(header), sizeof(header));
+    if (!out) throw std::runtime_error("Cannot create matrix file");
+  }
+  std::filesystem::resize_file(
+      path_, kHeaderSize + static_cast<std::uintmax_t>(rows_) * cols_ *
+                               sizeof(double));
+  file_.open(path_, std::ios::binary | std::ios::in | std::ios::out);
+  if (!file_) throw std::runtime_error("Cannot open matrix file");
+}
+
+S21DiskMatrix::S21DiskMatrix(const std::string& path)
+    : path_(path), rows_(0), cols_(0) {
+  file_.open(path_, std::ios::binary | std::ios::in | std::ios::out);
+  if (!file_) throw std::runtime_error("Cannot open matrix file");
+  std::int64_t header[2] = {0, 0};
+  file_.read(reinterpret_cast<char*>(header), sizeof(header));
+  constexpr std::int64_t kMaxDim = std::numeric_limits<int>::max();
+  if (!file_ || header[0] < 1 || header[1] < 1 || header[0] > kMaxDim ||
+      header[1] > kMaxDim) {
+    throw std::runtime_error("Invalid matrix file");
+  }
+  // The data must fill the file exactly; a short or padded file would
+  // otherwise surface later as short reads.
+  std::uintmax_t cells = static_cast<std::uintmax_t>(header[0]) * header[1];
+  std::uintmax_t data = std::filesystem::file_size(path_) - kHeaderSize;
+  if (data % sizeof(double) != 0 || data / sizeof(double) != cells) {
+    throw std::runtime_error("Matrix file size does not match its header");
+  }
+  rows_ = static_cast<int>(header[0]);
+  cols_ = static_cast<int>(header[1]);
+}
+
+S21DiskMatrix S21DiskMatrix::FromMatrix(const std::string& path,
+                                        const S21Matrix& matrix) {
+  S21DiskMatrix res(path, matrix.GetRows(), matrix.GetCols());
+  std::vector<double> row(res.cols_);
+  for (int i = 0; i < res.rows_; i++) {
+    for (int j = 0; j < res.cols_; j++) row[j] = matrix(i, j);
+    res.WriteBlock(i, 0, 1, res.cols_, row.data());
+  }
+  return res;
+}
+
+S21Matrix S21DiskMatrix::ToMatrix() {
+  S21Matrix res(rows_, cols_);
+  std::vector<double> row(cols_);
+  for (int i = 0; i < rows_; i++) {
+    ReadBlock(i, 0, 1, cols_, row.data());
+    for (int j = 0; j < cols_; j++) res(i, j) = row[j];
+  }
+  return res;
+}
+
+int S21DiskMatrix::GetRows() const { return rows_; }
+
+int S21DiskMatrix::GetCols() const { return cols_; }
+
+const std::string& S21DiskMatrix::GetPath() const { return path_; }
+
+void S21DiskMatrix::ReadBlock(int row, int col, int rows, int cols,
+                              double* dst) {
+  checkBlock(row, col, rows, cols);
+  for (int i = 0; i < rows; i++) {
+    file_.seekg(offset(row + i, col));
+    file_.read(reinterpret_cast<char*>(dst + static_cast<size_t>(i) * cols),
+               static_cast<std::streamsize>(cols * sizeof(double)));
+  }
+  if (!file_) throw std::runtime_error("Matrix file read failed");
+}
+
+void S21DiskMatrix::WriteBlock(int row, int col, int rows, int cols,
+                               const double* src) {
+  checkBlock(row, col, rows, cols);
+  for (int i = 0; i < rows; i++) {
+    file_.seekp(offset(row + i, col));
+    file_.write(
+        reinterpret_cast<const char*>(src + static_cast<size_t>(i) * cols),
+        static_cast<std::streamsize>(cols * sizeof(double)));
+  }
+  file_.flush();
+  if (!file_) throw std::runtime_error("Matrix file write failed");
+}
+
+void S21DiskMatrix::checkBlock(int row, int col, int rows, int cols) const {
+  if (row < 0 || col < 0 || rows < 0 || cols < 0 || row + rows > rows_ ||
+      col + cols > cols_) {
+    throw std::out_of_range("Beyond the matrix.");
+  }
+}
+
+std::streamoff S21DiskMatrix::offset(int row, int col) const {
+  return kHeaderSize + (static_cast<std::streamoff>(row) * cols_ + col) *
+                           static_cast<std::streamoff>(sizeof(double));
+}
+
+S21DiskMatrix MulMatrixOutOfCore(S21DiskMatrix& a, S21DiskMatrix& b,
+                                 const std::string& result_path,
+                                 std::size_t memory_budget) {
+  if (a.GetCols() != b.GetRows()) {
+    throw std::logic_error("Incorrect matrix");
+  }
+  if (result_path == a.GetPath() || result_path == b.GetPath()) {
+    throw std::invalid_argument("Result must not overwrite an operand");
+  }
+  // Two A tiles and two B tiles for the double buffer plus one C tile.
+  std::size_t tile_doubles = memory_budget / (5 * sizeof(double));
+  int tile = static_cast<int>(std::sqrt(static_cast<double>(tile_doubles)));
+  if (tile < 1) throw std::invalid_argument("Memory budget is too small");
+  int rows = a.GetRows(), cols = b.GetCols(), inner = a.GetCols();
+  tile = std::min(tile, std::max({rows, cols, inner}));
+
+  S21DiskMatrix res(result_path, rows, cols);
+  // Steps run k fastest, then j, then i. Each one is computed from its
+  // index, so no step list outside the memory budget is built.
+  std::size_t tiles_j = (cols + tile - 1) / tile;
+  std::size_t tiles_k = (inner + tile - 1) / tile;
+  std::size_t step_count =
+      static_cast<std::size_t>((rows + tile - 1) / tile) * tiles_j * tiles_k;
+  if (step_count == 0) return res;
+  auto step_at = [tile, tiles_j, tiles_k](std::size_t s) {
+    return TileStep{static_cast<int>(s / (tiles_j * tiles_k)) * tile,
+                    static_cast<int>(s / tiles_k % tiles_j) * tile,
+                    static_cast<int>(s % tiles_k) * tile};
+  };
+
+  auto extent = [tile](int start, int size) {
+    return std::min(tile, size - start);
+  };
+  auto load = [&](const TileStep& s, TilePair& buf) {
+    int ti = extent(s.row, rows), tj = extent(s.col, cols),
+        tk = extent(s.inner, inner);
+    a.ReadBlock(s.row, s.inner, ti, tk, buf.a.data());
+    b.ReadBlock(s.inner, s.col, tk, tj, buf.b.data());
+  };
+
+  std::size_t tile_size = static_cast<std::size_t>(tile) * tile;
+  TilePair buffers[2];
+  for (TilePair& buf : buffers) {
+    buf.a.resize(tile_size);
+    buf.b.resize(tile_size);
+  }
+  std::vector<double> c(tile_size);
+  load(step_at(0), buffers[0]);
+
+  for (std::size_t s = 0; s < step_count; s++) {
+    TilePair& cur = buffers[s % 2];
+    std::future<void> prefetch;
+    if (s + 1 < step_count) {
+      prefetch = std::async(std::launch::async, load, step_at(s + 1),
+                            std::ref(buffers[(s + 1) % 2]));
+    }
+    TileStep step = step_at(s);
+    int ti = extent(step.row, rows), tj = extent(step.col, cols),
+        tk = extent(step.inner, inner);
+    if (step.inner == 0) std::fill(c.begin(), c.end(), 0.0);
+    for (int i = 0; i < ti; i++) {
+      double* c_row = c.data() + static_cast<std::size_t>(i) * tj;
+      for (int k = 0; k < tk; k++) {
+        double a_ik = cur.a[static_cast<std::size_t>(i) * tk + k];
+        const double* b_row = cur.b.data() + static_cast<std::size_t>(k) * tj;
+        for (int j = 0; j < tj; j++) c_row[j] += a_ik * b_row[j];
+      }
+    }
+    if (step.inner + tk >= inner) {
+      res.WriteBlock(step.row, step.col, ti, tj, c.data());
+    }
+    if (prefetch.valid()) prefetch.get();
+  }
+  return res;
+}
@@ -0,0 +1,47 @@
+#ifndef CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_DISK_H_
+#define CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_DISK_H_
+
+#include <cstddef>
+#include <fstream>
+#include <string>
+
+#include "s21_matrix_oop.h"
+
+// File-backed matrix: a small header (rows, cols) followed by the elements
+// in row-major order. Only the requested blocks are ever held in memory.
+class S21DiskMatrix {
+ public:
+  S21DiskMatrix(const std::string& path, int rows, int cols);
+  explicit S21DiskMatrix(const std::string& path);
+  S21DiskMatrix(S21DiskMatrix&& other) noexcept = default;
+  S21DiskMatrix& operator=(S21DiskMatrix&& other) noexcept = default;
+  ~S21DiskMatrix() = default;
+
+  static S21DiskMatrix FromMatrix(const std::string& path,
+                                  const S21Matrix& matrix);
+  S21Matrix ToMatrix();
+
+  int GetRows() const;
+  int GetCols() const;
+  const std::string& GetPath() const;
+
+  void ReadBlock(int row, int col, int rows, int cols, double* dst);
+  void WriteBlock(int row, int col, int rows, int cols, const double* src);
+
+ private:
+  void checkBlock(int row, int col, int rows, int cols) const;
+  std::streamoff offset(int row, int col) const;
+
+  std::string path_;
+  int rows_, cols_;
+  std::fstream file_;
+};
+
+// Tiled product a * b written to result_path. At most memory_budget bytes of
+// tile buffers are used; the next pair of tiles is read on a background
+// thread while the current pair is multiplied.
+S21DiskMatrix MulMatrixOutOfCore(S21DiskMatrix& a, S21DiskMatrix& b,
+                                 const std::string& result_path,
+                                 std::size_t memory_budget);
+
+#endif  // CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_DISK_H_
@@ -0,0 +1,204 @@
+#ifndef CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_FIXED_H_
+#define CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_FIXED_H_
+
+#include <initializer_list>
+#include <stdexcept>
+
+#include "s21_matrix_oop.h"
+
+// Matrix with compile-time dimensions and inline storage. Everything except
+// ToMatrix is constexpr, so products of constant transforms fold into
+// literals. Errors that S21Matrix reports at runtime (singular inverse,
+// index out of range) become compile errors in a constant expression.
+template <int Rows, int Cols>
+class S21FixedMatrix {
+  static_assert(Rows > 0 && Cols > 0, "Invalid number of columns or rows");
+
+ public:
+  constexpr S21FixedMatrix() = default;
+  constexpr S21FixedMatrix(std::initializer_list<double> values) {
+    if (values.size() != static_cast<size_t>(Rows * Cols)) {
+      throw std::invalid_argument("Invalid number of values");
+    }
+    int n = 0;
+    for (double value : values) {
+      matrix_[n / Cols][n % Cols] = value;
+      n++;
+    }
+  }
+
+  static constexpr S21FixedMatrix Identity() {
+    static_assert(Rows == Cols, "Rows are not equal to columns");
+    S21FixedMatrix res;
+    for (int i = 0; i < Rows; i++) res.matrix_[i][i] = 1;
+    return res;
+  }
+
+  constexpr int GetRows() const { return Rows; }
+  constexpr int GetCols() const { return Cols; }
+
+  constexpr double operator()(int row, int col) const {
+    if (row < 0 || col < 0 || row >= Rows || col >= Cols)
+      throw std::out_of_range("Beyond the matrix.");
+    return matrix_[row][col];
+  }
+
+  constexpr double& operator()(int row, int col) {
+    if (row < 0 || col < 0 || row >= Rows || col >= Cols)
+      throw std::out_of_range("Beyond the matrix.");
+    return matrix_[row][col];
+  }
+
+  constexpr bool EqMatrix(const S21FixedMatrix& other) const {
+    for (int i = 0; i < Rows; i++) {
+      for (int j = 0; j < Cols; j++) {
+        if (abs(matrix_[i][j] - other.matrix_[i][j]) > epsilon) return false;
+      }
+    }
+    return true;
+  }
+
+  constexpr S21FixedMatrix operator+(const S21FixedMatrix& other) const {
+    S21FixedMatrix res(*this);
+    for (int i = 0; i < Rows; i++) {
+      for (int j = 0; j < Cols; j++) res.matrix_[i][j] += other.matrix_[i][j];
+    }
+    return res;
+  }
+
+  constexpr S21FixedMatrix operator-(const S21FixedMatrix& other) const {
+    S21FixedMatrix res(*this);
+    for (int i = 0; i < Rows; i++) {
+      for (int j = 0; j < Cols; j++) res.matrix_[i][j] -= other.matrix_[i][j];
+    }
+    return res;
+  }
+
+  constexpr S21FixedMatrix operator*(double num) const {
+    S21FixedMatrix res(*this);
+    for (int i = 0; i < Rows; i++) {
+      for (int j = 0; j < Cols; j++) res.matrix_[i][j] *= num;
+    }
+    return res;
+  }
+
+  template <int OtherCols>
+  constexpr S21FixedMatrix<Rows, OtherCols> operator*(
+      const S21FixedMatrix<Cols, OtherCols>& other) const {
+    S21FixedMatrix<Rows, OtherCols> res;
+    for (int i = 0; i < Rows; i++) {
+      for (int k = 0; k < Cols; k++) {
+        for (int j = 0; j < OtherCols; j++) {
+          res.matrix_[i][j] += matrix_[i][k] * other.matrix_[k][j];
+        }
+      }
+    }
+    return res;
+  }
+
+  constexpr bool operator==(const S21FixedMatrix& other) const {
+    return EqMatrix(other);
+  }
+
+  constexpr S21FixedMatrix<Cols, Rows> Transpose() const {
+    S21FixedMatrix<Cols, Rows> res;
+    for (int i = 0; i < Rows; i++) {
+      for (int j = 0; j < Cols; j++) res.matrix_[j][i] = matrix_[i][j];
+    }
+    return res;
+  }
+
+  // Gaussian elimination with partial pivoting.
+  constexpr double Determinant() const {
+    static_assert(Rows == Cols, "Rows are not equal to columns");
+    S21FixedMatrix tmp(*this);
+    double result = 1;
+    for (int col = 0; col < Rows; col++) {
+      int pivot = tmp.pivotRow(col);
+      if (tmp.matrix_[pivot][col] == 0) return 0;
+      if (pivot != col) {
+        tmp.swapRows(pivot, col);
+        result = -result;
+      }
+      result *= tmp.matrix_[col][col];
+      for (int i = col + 1; i < Rows; i++) {
+        double factor = tmp.matrix_[i][col] / tmp.matrix_[col][col];
+        for (int j = col; j < Cols; j++) {
+          tmp.matrix_[i][j] -= factor * tmp.matrix_[col][j];
+        }
+      }
+    }
+    return result;
+  }
+
+  // Gauss-Jordan elimination on [A | I].
+  constexpr S21FixedMatrix InverseMatrix() const {
+    static_assert(Rows == Cols, "Rows are not equal to columns");
+    S21FixedMatrix tmp(*this);
+    S21FixedMatrix res = Identity();
+    for (int col = 0; col < Rows; col++) {
+      int pivot = tmp.pivotRow(col);
+      if (abs(tmp.matrix_[pivot][col]) < epsilon) {
+        throw std::invalid_argument("The matrix cannot be inverted");
+      }
+      tmp.swapRows(pivot, col);
+      res.swapRows(pivot, col);
+      double scale = 1 / tmp.matrix_[col][col];
+      for (int j = 0; j < Cols; j++) {
+        tmp.matrix_[col][j] *= scale;
+        res.matrix_[col][j] *= scale;
+      }
+      for (int i = 0; i < Rows; i++) {
+        if (i == col) continue;
+        double factor = tmp.matrix_[i][col];
+        for (int j = 0; j < Cols; j++) {
+          tmp.matrix_[i][j] -= factor * tmp.matrix_[col][j];
+          res.matrix_[i][j] -= factor * res.matrix_[col][j];
+        }
+      }
+    }
+    return res;
+  }
+
+  S21Matrix ToMatrix() const {
+    S21Matrix res(Rows, Cols);
+    for (int i = 0; i < Rows; i++) {
+      for (int j = 0; j < Cols; j++) res(i, j) = matrix_[i][j];
+    }
+    return res;
+  }
+
+ private:
+  template <int, int>
+  friend class S21FixedMatrix;
+
+  static constexpr double abs(double value) {
+    return value < 0 ? -value : value;
+  }
+
+  constexpr int pivotRow(int col) const {
+    int pivot = col;
+    for (int i = col + 1; i < Rows; i++) {
+      if (abs(matrix_[i][col]) > abs(matrix_[pivot][col])) pivot = i;
+    }
+    return pivot;
+  }
+
+  constexpr void swapRows(int a, int b) {
+    for (int j = 0; j < Cols; j++) {
+      double tmp = matrix_[a][j];
+      matrix_[a][j] = matrix_[b][j];
+      matrix_[b][j] = tmp;
+    }
+  }
+
+  double matrix_[Rows][Cols]{};
+};
+
+template <int Rows, int Cols>
+constexpr S21FixedMatrix<Rows, Cols> operator*(
+    double number, const S21FixedMatrix<Rows, Cols>& other) {
+  return other * number;
+}
+
+#endif  // CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_FIXED_H_
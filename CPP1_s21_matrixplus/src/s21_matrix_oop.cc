@@ -1,12 +1,67 @@
 #include "s21_matrix_oop.h"
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <limits>
+#include <vector>
 
-S21Matrix::S21Matrix() : rows_(0), cols_(0), matrix_(nullptr) {}
+namespace {
+
+// Neumaier's variant of Kahan summation: the low-order bits lost by
+// sum + value are collected in comp and added back at the end.
+inline void kahanAdd(double& sum, double& comp, double value) {
+  double t = sum + value;
+  if (fabs(sum) >= fabs(value)) {
+    comp += (sum - t) + value;
+  } else {
+    comp += (value - t) + sum;
+  }
+  sum = t;
+}
+
+// Same correction as kahanAdd, computed with Knuth's TwoSum instead of a
+// magnitude test: the error of sum + value is exact for either ordering,
+// so the product kernel has no branch and a loop over columns vectorizes.
+inline void kahanStep(double& sum, double& comp, double value) {
+  double t = sum + value;
+  double v = t - sum;
+  comp += (sum - (t - v)) + (value - v);
+  sum = t;
+}
+
+class Accumulator {
+ public:
+  explicit Accumulator(bool compensated)
+      : compensated_(compensated), sum_(0), comp_(0) {}
+  void Add(double value) {
+    if (compensated_) {
+      kahanAdd(sum_, comp_, value);
+    } else {
+      sum_ += value;
+    }
+  }
+  double Result() const { return sum_ + comp_; }
+
+ private:
+  bool compensated_;
+  double sum_, comp_;
+};
+
+// Correction row for compensated products, allocated once by the caller
+// and reused by every mulInto; fast mode needs none.
+std::vector<double> mulScratch(S21Matrix::Accuracy accuracy, int cols) {
+  return std::vector<double>(
+      accuracy == S21Matrix::Accuracy::kCompensated ? cols : 0);
+}
+
+}  // namespace
+
+S21Matrix::S21Matrix()
+    : rows_(0), cols_(0), matrix_(nullptr), accuracy_(Accuracy::kFast) {}
 
 S21Matrix::S21Matrix(int rows, int cols)
-    : rows_(rows), cols_(cols), matrix_(nullptr) {
+    : rows_(rows), cols_(cols), matrix_(nullptr), accuracy_(Accuracy::kFast) {
   if (rows < 1 || cols < 1) {
     throw std::invalid_argument("Invalid number of columns or rows");
   }
@@ -14,7 +69,7 @@ S21Matrix::S21Matrix(int rows, int cols)
 }
 
 S21Matrix::S21Matrix(const S21Matrix& other)
-    : rows_(other.rows_), cols_(other.cols_) {
+    : rows_(other.rows_), cols_(other.cols_), accuracy_(other.accuracy_) {
   matrix_ = createMatrix(rows_, cols_);
   for (int i = 0; i < rows_; i++) {
     for (int j = 0; j < cols_; j++) {
@@ -24,14 +79,17 @@ S21Matrix::S21Matrix(const S21Matrix& other)
 }
 
 S21Matrix::S21Matrix(S21Matrix&& other) noexcept
-    : rows_(other.rows_), cols_(other.cols_), matrix_(other.matrix_) {
+    : rows_(other.rows_),
+      cols_(other.cols_),
+      matrix_(other.matrix_),
+      accuracy_(other.accuracy_) {
   other.rows_ = other.cols_ = 0;
   other.matrix_ = nullptr;
 }
 
 S21Matrix::~S21Matrix() { removeMatrix(); }
 
-bool S21Matrix::EqMatrix(const S21Matrix& other) {
+bool S21Matrix::EqMatrix(const S21Matrix& other) const {
   bool result = true;
   if (this != &other) {
     if (rows_ == other.rows_ && cols_ == other.cols_) {
@@ -85,18 +143,12 @@ void S21Matrix::MulMatrix(const S21Matrix& other) {
     throw std::logic_error("Incorrect matrix");
   }
   S21Matrix tmp(rows_, other.cols_);
-  for (int i = 0; i < rows_; i++) {
-    for (int j = 0; j < other.cols_; j++) {
-      tmp.matrix_[i][j] = 0;
-      for (int k = 0; k < cols_; k++) {
-        tmp.matrix_[i][j] += matrix_[i][k] * other.matrix_[k][j];
-      }
-    }
-  }
-  std::swap(*this, tmp);
+  std::vector<double> comp = mulScratch(accuracy_, other.cols_);
+  mulInto(*this, other, tmp, accuracy_, comp.data());
+  swapData(tmp);
 }
 
-S21Matrix S21Matrix::Transpose() {
+S21Matrix S21Matrix::Transpose() const {
   S21Matrix tmp(cols_, rows_);
   for (int i = 0; i < rows_; i++) {
     for (int j = 0; j < cols_; j++) {
@@ -106,7 +158,7 @@ S21Matrix S21Matrix::Transpose() {
   return tmp;
 }
 
-S21Matrix S21Matrix::CalcComplements() {
+S21Matrix S21Matrix::CalcComplements() const {
   if (cols_ != rows_) {
     throw std::logic_error("Rows are not equal to columns");
   }
@@ -131,7 +183,7 @@ S21Matrix S21Matrix::CalcComplements() {
   return res;
 }
 
-double S21Matrix::Determinant() {
+double S21Matrix::Determinant() const {
   if (rows_ != cols_) {
     throw std::logic_error("Rows are not equal to columns");
   }
@@ -155,7 +207,7 @@ double S21Matrix::Determinant() {
   return result;
 }
 
-S21Matrix S21Matrix::InverseMatrix() {
+S21Matrix S21Matrix::InverseMatrix() const {
   double det = Determinant();
   if (fabs(det) < epsilon) {
     throw std::invalid_argument("The matrix cannot be inverted");
@@ -171,10 +223,153 @@ S21Matrix S21Matrix::InverseMatrix() {
   return res;
 }
 
+S21Matrix S21Matrix::Pow(int power) const {
+  if (rows_ != cols_) {
+    throw std::logic_error("Rows are not equal to columns");
+  }
+  S21Matrix base(*this);
+  if (power < 0) {
+    S21Matrix inverse(rows_, cols_);
+    inverse.setIdentity();
+    solveInto(base, inverse);
+    base.swapData(inverse);
+  }
+  // Binary exponentiation; products land in tmp and are swapped back, so no
+  // allocation happens inside the loop.
+  S21Matrix res(rows_, cols_);
+  S21Matrix tmp(rows_, cols_);
+  std::vector<double> comp = mulScratch(accuracy_, cols_);
+  res.setIdentity();
+  res.accuracy_ = accuracy_;
+  unsigned int exp = power < 0 ? -static_cast<unsigned int>(power) : power;
+  while (exp) {
+    if (exp & 1u) {
+      mulInto(res, base, tmp, accuracy_, comp.data());
+      res.swapData(tmp);
+    }
+    exp >>= 1;
+    if (exp) {
+      mulInto(base, base, tmp, accuracy_, comp.data());
+      base.swapData(tmp);
+    }
+  }
+  return res;
+}
+
+S21Matrix S21Matrix::ExpM() const {
+  if (rows_ != cols_) {
+    throw std::logic_error("Rows are not equal to columns");
+  }
+  // Scaling and squaring with the diagonal (6, 6) Pade approximant:
+  // scale A by 2^-s so that its norm is at most 1/2, approximate, then
+  // square the result s times.
+  constexpr int kOrder = 6;
+  // Norm skips NaN through std::max, so the entries are checked as well;
+  // a finite norm also rules out row sums that overflow.
+  double norm = Norm(NormType::kInf);
+  bool finite = std::isfinite(norm);
+  for (int i = 0; finite && i < rows_; i++) {
+    for (int j = 0; j < cols_; j++) finite &= std::isfinite(matrix_[i][j]);
+  }
+  if (!finite) {
+    throw std::invalid_argument("Matrix has non-finite entries");
+  }
+  // A finite norm is below 2^max_exponent, which bounds the scale.
+  constexpr int kMaxScale = std::numeric_limits<double>::max_exponent + 1;
+  int scale = 0;
+  if (norm > 0.5) {
+    scale = std::min(static_cast<int>(std::ceil(std::log2(norm))) + 1,
+                     kMaxScale);
+  }
+  S21Matrix a(*this);
+  a.MulNumber(std::ldexp(1.0, -scale));
+
+  S21Matrix x(a);
+  S21Matrix numer(rows_, cols_);
+  S21Matrix denom(rows_, cols_);
+  S21Matrix tmp(rows_, cols_);
+  std::vector<double> comp = mulScratch(accuracy_, cols_);
+  numer.setIdentity();
+  denom.setIdentity();
+  numer.accuracy_ = accuracy_;
+  double c = 0.5;
+  for (int i = 0; i < rows_; i++) {
+    for (int j = 0; j < cols_; j++) {
+      numer.matrix_[i][j] += c * a.matrix_[i][j];
+      denom.matrix_[i][j] -= c * a.matrix_[i][j];
+    }
+  }
+  for (int k = 2; k <= kOrder; k++) {
+    c = c * (kOrder - k + 1) / (k * (2 * kOrder - k + 1));
+    mulInto(a, x, tmp, accuracy_, comp.data());
+    x.swapData(tmp);
+    double sign = k % 2 ? -1 : 1;
+    for (int i = 0; i < rows_; i++) {
+      for (int j = 0; j < cols_; j++) {
+        numer.matrix_[i][j] += c * x.matrix_[i][j];
+        denom.matrix_[i][j] += sign * c * x.matrix_[i][j];
+      }
+    }
+  }
+  solveInto(denom, numer);
+  for (int i = 0; i < scale; i++) {
+    mulInto(numer, numer, tmp, accuracy_, comp.data());
+    numer.swapData(tmp);
+  }
+  return numer;
+}
+
+double S21Matrix::Sum() const {
+  Accumulator sum(accuracy_ == Accuracy::kCompensated);
+  for (int i = 0; i < rows_; i++) {
+    for (int j = 0; j < cols_; j++) sum.Add(matrix_[i][j]);
+  }
+  return sum.Result();
+}
+
+double S21Matrix::Trace() const {
+  if (rows_ != cols_) {
+    throw std::logic_error("Rows are not equal to columns");
+  }
+  Accumulator sum(accuracy_ == Accuracy::kCompensated);
+  for (int i = 0; i < rows_; i++) sum.Add(matrix_[i][i]);
+  return sum.Result();
+}
+
+double S21Matrix::Norm(NormType type) const {
+  bool compensated = accuracy_ == Accuracy::kCompensated;
+  double result = 0;
+  if (type == NormType::kFrobenius) {
+    Accumulator sum(compensated);
+    for (int i = 0; i < rows_; i++) {
+      for (int j = 0; j < cols_; j++) sum.Add(matrix_[i][j] * matrix_[i][j]);
+    }
+    result = sqrt(sum.Result());
+  } else if (type == NormType::kInf) {
+    for (int i = 0; i < rows_; i++) {
+      Accumulator sum(compensated);
+      for (int j = 0; j < cols_; j++) sum.Add(fabs(matrix_[i][j]));
+      result = std::max(result, sum.Result());
+    }
+  } else {
+    // Column sums are accumulated row by row to keep the access contiguous.
+    std::vector<Accumulator> sums(cols_, Accumulator(compensated));
+    for (int i = 0; i < rows_; i++) {
+      for (int j = 0; j < cols_; j++) sums[j].Add(fabs(matrix_[i][j]));
+    }
+    for (const Accumulator& sum : sums) result = std::max(result, sum.Result());
+  }
+  return result;
+}
+
 int S21Matrix::GetRows() const { return rows_; }
 
 int S21Matrix::GetCols() const { return cols_; }
 
+S21Matrix::Accuracy S21Matrix::GetAccuracy() const { return accuracy_; }
+
+void S21Matrix::SetAccuracy(Accuracy accuracy) { accuracy_ = accuracy; }
+
 void S21Matrix::SetRows(int new_rows) {
   if (new_rows < 1) {
     throw std::invalid_argument("Invalid value");
@@ -186,7 +381,7 @@ void S21Matrix::SetRows(int new_rows) {
       res.matrix_[i][j] = matrix_[i][j];
     }
   }
-  std::swap(*this, res);
+  swapData(res);
 }
 
 void S21Matrix::SetCols(int new_cols) {
@@ -200,7 +395,7 @@ void S21Matrix::SetCols(int new_cols) {
       res.matrix_[i][j] = matrix_[i][j];
     }
   }
-  std::swap(*this, res);
+  swapData(res);
 }
 
 S21Matrix S21Matrix::operator+(const S21Matrix& other) const {
@@ -247,7 +442,9 @@ S21Matrix& S21Matrix::operator*=(const double num) {
   return *this;
 }
 
-bool S21Matrix::operator==(const S21Matrix& other) { return EqMatrix(other); }
+bool S21Matrix::operator==(const S21Matrix& other) const {
+  return EqMatrix(other);
+}
 
 S21Matrix& S21Matrix::operator=(const S21Matrix& other) {
   if (this != &other) {
@@ -265,11 +462,12 @@ S21Matrix& S21Matrix::operator=(S21Matrix&& other) noexcept {
     std::swap(rows_, other.rows_);
     std::swap(cols_, other.cols_);
     std::swap(matrix_, other.matrix_);
+    accuracy_ = other.accuracy_;
   }
   return *this;
 }
 
-S21Matrix operator*(double number, S21Matrix& other) {
+S21Matrix operator*(double number, const S21Matrix& other) {
   S21Matrix tmp(other);
   tmp *= number;
   return tmp;
@@ -298,3 +496,85 @@ void S21Matrix::removeMatrix() {
   delete[] matrix_;
   matrix_ = nullptr;
 }
+
+void S21Matrix::swapData(S21Matrix& other) noexcept {
+  std::swap(rows_, other.rows_);
+  std::swap(cols_, other.cols_);
+  std::swap(matrix_, other.matrix_);
+}
+
+void S21Matrix::setIdentity() {
+  for (int i = 0; i < rows_; i++) {
+    for (int j = 0; j < cols_; j++) {
+      matrix_[i][j] = i == j ? 1 : 0;
+    }
+  }
+}
+
+// res = a * b. res must already have the right size and must not alias
+// a or b. The i-k-j order streams rows of b and res, and the compensated
+// variant keeps one correction term per output column, in comp. It uses
+// the branch-free kahanStep, so both inner loops vectorize. comp must hold
+// b.cols_ doubles in compensated mode (see mulScratch).
+void S21Matrix::mulInto(const S21Matrix& a, const S21Matrix& b,
+                        S21Matrix& res, Accuracy accuracy, double* comp) {
+  if (accuracy == Accuracy::kFast) {
+    for (int i = 0; i < a.rows_; i++) {
+      double* res_row = res.matrix_[i];
+      for (int j = 0; j < b.cols_; j++) res_row[j] = 0;
+      for (int k = 0; k < a.cols_; k++) {
+        double a_ik = a.matrix_[i][k];
+        const double* b_row = b.matrix_[k];
+        for (int j = 0; j < b.cols_; j++) res_row[j] += a_ik * b_row[j];
+      }
+    }
+    return;
+  }
+  for (int i = 0; i < a.rows_; i++) {
+    double* res_row = res.matrix_[i];
+    for (int j = 0; j < b.cols_; j++) res_row[j] = comp[j] = 0;
+    for (int k = 0; k < a.cols_; k++) {
+      double a_ik = a.matrix_[i][k];
+      const double* b_row = b.matrix_[k];
+      for (int j = 0; j < b.cols_; j++) {
+        kahanStep(res_row[j], comp[j], a_ik * b_row[j]);
+      }
+    }
+    for (int j = 0; j < b.cols_; j++) res_row[j] += comp[j];
+  }
+}
+
+// Solves a * x = b by Gaussian elimination with partial pivoting. Both
+// arguments are overwritten; the solution is left in b.
+void S21Matrix::solveInto(S21Matrix& a, S21Matrix& b) {
+  int n = a.rows_;
+  for (int col = 0; col < n; col++) {
+    int pivot = col;
+    for (int i = col + 1; i < n; i++) {
+      if (fabs(a.matrix_[i][col]) > fabs(a.matrix_[pivot][col])) pivot = i;
+    }
+    if (fabs(a.matrix_[pivot][col]) < epsilon) {
+      throw std::invalid_argument("The matrix cannot be inverted");
+    }
+    std::swap(a.matrix_[pivot], a.matrix_[col]);
+    std::swap(b.matrix_[pivot], b.matrix_[col]);
+    for (int i = col + 1; i < n; i++) {
+      double factor = a.matrix_[i][col] / a.matrix_[col][col];
+      for (int j = col; j < n; j++) {
+        a.matrix_[i][j] -= factor * a.matrix_[col][j];
+      }
+      for (int j = 0; j < b.cols_; j++) {
+        b.matrix_[i][j] -= factor * b.matrix_[col][j];
+      }
+    }
+  }
+  for (int col = n - 1; col >= 0; col--) {
+    for (int j = 0; j < b.cols_; j++) {
+      double sum = b.matrix_[col][j];
+      for (int k = col + 1; k < n; k++) {
+        sum -= a.matrix_[col][k] * b.matrix_[k][j];
+      }
+      b.matrix_[col][j] = sum / a.matrix_[col][col];
+    }
+  }
+}
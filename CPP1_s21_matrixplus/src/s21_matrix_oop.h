@@ -3,28 +3,43 @@
 
 constexpr double epsilon = 1e-7;
 
+// All const member functions only read the matrix and keep no hidden
+// state, so any number of threads may call them concurrently on a shared
+// matrix as long as no thread modifies it at the same time.
 class S21Matrix {
  public:
+  // kCompensated switches products and reductions to Kahan-Babuska
+  // summation. The mode is copied along with the matrix.
+  enum class Accuracy { kFast, kCompensated };
+  enum class NormType { kFrobenius, kOne, kInf };
+
   S21Matrix();
   explicit S21Matrix(int rows, int cols);
   S21Matrix(const S21Matrix& other);
   S21Matrix(S21Matrix&& other) noexcept;
   ~S21Matrix();
 
-  bool EqMatrix(const S21Matrix& other);
+  bool EqMatrix(const S21Matrix& other) const;
   void SumMatrix(const S21Matrix& other);
   void SubMatrix(const S21Matrix& other);
   void MulNumber(const double num);
   void MulMatrix(const S21Matrix& other);
-  S21Matrix Transpose();
-  S21Matrix CalcComplements();
-  double Determinant();
-  S21Matrix InverseMatrix();
+  S21Matrix Transpose() const;
+  S21Matrix CalcComplements() const;
+  double Determinant() const;
+  S21Matrix InverseMatrix() const;
+  S21Matrix Pow(int power) const;
+  S21Matrix ExpM() const;
+  double Sum() const;
+  double Trace() const;
+  double Norm(NormType type = NormType::kFrobenius) const;
 
   int GetRows() const;
   int GetCols() const;
   void SetRows(int new_rows);
   void SetCols(int new_cols);
+  Accuracy GetAccuracy() const;
+  void SetAccuracy(Accuracy accuracy);
 
   S21Matrix operator+(const S21Matrix& other) const;
   S21Matrix operator-(const S21Matrix& other) const;
@@ -34,19 +49,25 @@ class S21Matrix {
   S21Matrix& operator-=(const S21Matrix& other);
   S21Matrix& operator*=(const S21Matrix& other);
   S21Matrix& operator*=(const double num);
-  bool operator==(const S21Matrix& other);
+  bool operator==(const S21Matrix& other) const;
   S21Matrix& operator=(const S21Matrix& other);
   S21Matrix& operator=(S21Matrix&& other) noexcept;
-  friend S21Matrix operator*(double number, S21Matrix& other);
+  friend S21Matrix operator*(double number, const S21Matrix& other);
   double operator()(int row, int col) const;
   double& operator()(int row, int col);
 
  private:
   double** createMatrix(int rows, int cols) const;
   void removeMatrix();
+  void swapData(S21Matrix& other) noexcept;
+  void setIdentity();
+  static void mulInto(const S21Matrix& a, const S21Matrix& b, S21Matrix& res,
+                      Accuracy accuracy, double* comp);
+  static void solveInto(S21Matrix& a, S21Matrix& b);
 
   int rows_, cols_;
   double** matrix_;
+  Accuracy accuracy_;
 };
 
 #endif  // CPP1_S21_MATRIXPLUS_SRC_S21_MATRIX_OOP_H_
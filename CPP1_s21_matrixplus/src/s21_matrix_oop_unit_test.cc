@@ -1,7 +1,16 @@
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
 #include <iostream>
+#include <limits>
+#include <thread>
+#include <vector>
 
+#include "s21_matrix_disk.h"
+#include "s21_matrix_fixed.h"
 #include "s21_matrix_oop.h"
 
 TEST(Constructors, SizeIndex) {
@@ -754,6 +763,294 @@ TEST(AccessorMutator, SetCol3) {
   EXPECT_ANY_THROW(matrix.SetCols(-1));
 }
 
+TEST(Pow, Fibonacci) {
+  S21Matrix matrix(2, 2);
+  matrix(0, 0) = 1.0;
+  matrix(0, 1) = 1.0;
+  matrix(1, 0) = 1.0;
+  matrix(1, 1) = 0.0;
+
+  S21Matrix result = matrix.Pow(10);
+
+  EXPECT_DOUBLE_EQ(result(0, 0), 89.0);
+  EXPECT_DOUBLE_EQ(result(0, 1), 55.0);
+  EXPECT_DOUBLE_EQ(result(1, 0), 55.0);
+  EXPECT_DOUBLE_EQ(result(1, 1), 34.0);
+}
+
+TEST(Pow, ZeroAndNegative) {
+  S21Matrix matrix(2, 2);
+  matrix(0, 0) = 2.0;
+  matrix(0, 1) = 1.0;
+  matrix(1, 0) = 7.0;
+  matrix(1, 1) = 4.0;
+  S21Matrix identity(2, 2);
+  identity(0, 0) = 1.0;
+  identity(1, 1) = 1.0;
+
+  EXPECT_TRUE(matrix.Pow(0) == identity);
+  EXPECT_TRUE(matrix.Pow(1) == matrix);
+  EXPECT_TRUE(matrix.Pow(-3) * matrix.Pow(3) == identity);
+}
+
+TEST(Pow, MarkovChain) {
+  S21Matrix matrix(2, 2);
+  matrix(0, 0) = 0.9;
+  matrix(0, 1) = 0.1;
+  matrix(1, 0) = 0.5;
+  matrix(1, 1) = 0.5;
+
+  S21Matrix result = matrix.Pow(1000000);
+
+  EXPECT_NEAR(result(0, 0), 5.0 / 6.0, 1e-9);
+  EXPECT_NEAR(result(0, 1), 1.0 / 6.0, 1e-9);
+  EXPECT_NEAR(result(1, 0), 5.0 / 6.0, 1e-9);
+  EXPECT_NEAR(result(1, 1), 1.0 / 6.0, 1e-9);
+}
+
+TEST(Pow, Fail) {
+  S21Matrix matrix_1(2, 3);
+  S21Matrix matrix_2(2, 2);
+
+  EXPECT_ANY_THROW(matrix_1.Pow(2));
+  EXPECT_ANY_THROW(matrix_2.Pow(-1));
+}
+
+TEST(ExpM, Nilpotent) {
+  S21Matrix matrix(2, 2);
+  matrix(0, 1) = 1.0;
+
+  S21Matrix result = matrix.ExpM();
+
+  EXPECT_NEAR(result(0, 0), 1.0, 1e-12);
+  EXPECT_NEAR(result(0, 1), 1.0, 1e-12);
+  EXPECT_NEAR(result(1, 0), 0.0, 1e-12);
+  EXPECT_NEAR(result(1, 1), 1.0, 1e-12);
+}
+
+TEST(ExpM, Rotation) {
+  S21Matrix matrix(2, 2);
+  matrix(0, 1) = -10.0;
+  matrix(1, 0) = 10.0;
+
+  S21Matrix result = matrix.ExpM();
+
+  EXPECT_NEAR(result(0, 0), std::cos(10.0), 1e-10);
+  EXPECT_NEAR(result(0, 1), -std::sin(10.0), 1e-10);
+  EXPECT_NEAR(result(1, 0), std::sin(10.0), 1e-10);
+  EXPECT_NEAR(result(1, 1), std::cos(10.0), 1e-10);
+}
+
+TEST(ExpM, Diagonal) {
+  S21Matrix matrix(3, 3);
+  matrix(0, 0) = 1.0;
+  matrix(1, 1) = -2.0;
+  matrix(2, 2) = 5.0;
+
+  S21Matrix result = matrix.ExpM();
+
+  EXPECT_NEAR(result(0, 0), std::exp(1.0), 1e-12);
+  EXPECT_NEAR(result(1, 1), std::exp(-2.0), 1e-12);
+  EXPECT_NEAR(result(2, 2) / std::exp(5.0), 1.0, 1e-12);
+  EXPECT_NEAR(result(0, 2), 0.0, 1e-12);
+}
+
+TEST(ExpM, NoSquareFail) {
+  S21Matrix matrix(2, 3);
+  EXPECT_ANY_THROW(matrix.ExpM());
+}
+
+TEST(ExpM, NonFiniteFail) {
+  S21Matrix matrix(2, 2);
+  matrix(0, 1) = std::numeric_limits<double>::infinity();
+  EXPECT_THROW(matrix.ExpM(), std::invalid_argument);
+  matrix(0, 1) = std::numeric_limits<double>::quiet_NaN();
+  EXPECT_THROW(matrix.ExpM(), std::invalid_argument);
+  // Both entries are finite, but the row sum overflows the norm.
+  matrix(0, 0) = matrix(0, 1) = std::numeric_limits<double>::max();
+  EXPECT_THROW(matrix.ExpM(), std::invalid_argument);
+}
+
+TEST(Reductions, SumTraceNorm) {
+  S21Matrix matrix(2, 2);
+  matrix(0, 0) = 1.0;
+  matrix(0, 1) = -2.0;
+  matrix(1, 0) = 3.0;
+  matrix(1, 1) = -4.0;
+
+  EXPECT_DOUBLE_EQ(matrix.Sum(), -2.0);
+  EXPECT_DOUBLE_EQ(matrix.Trace(), -3.0);
+  EXPECT_DOUBLE_EQ(matrix.Norm(), std::sqrt(30.0));
+  EXPECT_DOUBLE_EQ(matrix.Norm(S21Matrix::NormType::kOne), 6.0);
+  EXPECT_DOUBLE_EQ(matrix.Norm(S21Matrix::NormType::kInf), 7.0);
+}
+
+TEST(Reductions, TraceNoSquareFail) {
+  S21Matrix matrix(2, 3);
+  EXPECT_ANY_THROW(matrix.Trace());
+}
+
+TEST(Accuracy, CompensatedSum) {
+  S21Matrix matrix(1, 3);
+  matrix(0, 0) = 1e16;
+  matrix(0, 1) = 1.0;
+  matrix(0, 2) = -1e16;
+
+  EXPECT_DOUBLE_EQ(matrix.Sum(), 0.0);
+  matrix.SetAccuracy(S21Matrix::Accuracy::kCompensated);
+  EXPECT_DOUBLE_EQ(matrix.Sum(), 1.0);
+}
+
+TEST(Accuracy, CompensatedMulMatrix) {
+  S21Matrix matrix_1(1, 3);
+  matrix_1(0, 0) = 1e16;
+  matrix_1(0, 1) = 1.0;
+  matrix_1(0, 2) = -1e16;
+  S21Matrix matrix_2(3, 1);
+  matrix_2(0, 0) = 1.0;
+  matrix_2(1, 0) = 1.0;
+  matrix_2(2, 0) = 1.0;
+
+  EXPECT_DOUBLE_EQ((matrix_1 * matrix_2)(0, 0), 0.0);
+  matrix_1.SetAccuracy(S21Matrix::Accuracy::kCompensated);
+  S21Matrix result = matrix_1 * matrix_2;
+
+  EXPECT_DOUBLE_EQ(result(0, 0), 1.0);
+  EXPECT_EQ(result.GetAccuracy(), S21Matrix::Accuracy::kCompensated);
+}
+
+TEST(Concurrency, ConstQueries) {
+  S21Matrix source(3, 3);
+  source(0, 0) = 2.0;
+  source(0, 1) = 5.0;
+  source(0, 2) = 7.0;
+  source(1, 0) = 6.0;
+  source(1, 1) = 3.0;
+  source(1, 2) = 4.0;
+  source(2, 0) = 5.0;
+  source(2, 1) = -2.0;
+  source(2, 2) = -3.0;
+  const S21Matrix matrix(source);
+  const S21Matrix inverse = matrix.InverseMatrix();
+  const S21Matrix complements = matrix.CalcComplements();
+  const S21Matrix transpose = matrix.Transpose();
+
+  std::vector<int> mismatches(8, 0);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 8; t++) {
+    threads.emplace_back([&, t] {
+      for (int i = 0; i < 200; i++) {
+        if (matrix.Determinant() != -1.0) mismatches[t]++;
+        if (!(matrix.InverseMatrix() == inverse)) mismatches[t]++;
+        if (!matrix.CalcComplements().EqMatrix(complements)) mismatches[t]++;
+        if (!(matrix.Transpose() == transpose)) mismatches[t]++;
+        if (!(matrix * inverse).EqMatrix(2.0 * inverse * matrix * 0.5)) {
+          mismatches[t]++;
+        }
+      }
+    });
+  }
+  for (std::thread& thread : threads) thread.join();
+
+  for (int count : mismatches) EXPECT_EQ(count, 0);
+}
+
+TEST(FixedMatrix, CompileTime) {
+  constexpr S21FixedMatrix<3, 3> rotate{0, -1, 0, 1, 0, 0, 0, 0, 1};
+  constexpr S21FixedMatrix<3, 3> scale{2, 0, 0, 0, 3, 0, 0, 0, 4};
+  constexpr S21FixedMatrix<3, 3> transform = rotate * scale;
+  constexpr S21FixedMatrix<3, 1> point{1, 1, 1};
+
+  static_assert(transform(0, 1) == -3.0);
+  static_assert(transform(1, 0) == 2.0);
+  static_assert((transform * point)(2, 0) == 4.0);
+  static_assert(transform.Determinant() == 24.0);
+  static_assert(rotate.Transpose() == rotate.InverseMatrix());
+  static_assert(transform * transform.InverseMatrix() ==
+                S21FixedMatrix<3, 3>::Identity());
+  static_assert(point.Transpose().GetCols() == 3);
+  EXPECT_TRUE(transform.ToMatrix() == rotate.ToMatrix() * scale.ToMatrix());
+}
+
+TEST(FixedMatrix, MatchesRuntime) {
+  S21FixedMatrix<4, 4> fixed{2, 8, 7, 4, 4, 1, 7, 3,
+                             7, 7, 1, 7, 6, 3, 5, 9};
+  S21Matrix matrix = fixed.ToMatrix();
+
+  EXPECT_NEAR(fixed.Determinant(), matrix.Determinant(), 1e-9);
+  EXPECT_TRUE(fixed.InverseMatrix().ToMatrix() == matrix.InverseMatrix());
+  EXPECT_TRUE((2.0 * fixed - fixed + fixed).ToMatrix() == matrix * 2.0);
+}
+
+TEST(FixedMatrix, Fail) {
+  S21FixedMatrix<2, 2> singular{1, 2, 2, 4};
+
+  EXPECT_DOUBLE_EQ(singular.Determinant(), 0.0);
+  EXPECT_ANY_THROW(singular.InverseMatrix());
+  EXPECT_ANY_THROW(singular(2, 0));
+  EXPECT_ANY_THROW((S21FixedMatrix<2, 2>{1, 2, 3}));
+}
+
+TEST(OutOfCore, MulMatchesInMemory) {
+  S21Matrix matrix_1(7, 5);
+  S21Matrix matrix_2(5, 6);
+  for (int i = 0; i < 7; i++)
+    for (int j = 0; j < 5; j++) matrix_1(i, j) = i * 1.5 - j;
+  for (int i = 0; i < 5; i++)
+    for (int j = 0; j < 6; j++) matrix_2(i, j) = (i + 1) * 0.25 + j;
+  S21DiskMatrix disk_1 = S21DiskMatrix::FromMatrix("ooc_a.bin", matrix_1);
+  S21DiskMatrix disk_2 = S21DiskMatrix::FromMatrix("ooc_b.bin", matrix_2);
+
+  // 2x2 tiles, so every dimension has a ragged edge tile.
+  S21DiskMatrix result =
+      MulMatrixOutOfCore(disk_1, disk_2, "ooc_c.bin", 5 * 4 * sizeof(double));
+
+  EXPECT_EQ(result.GetRows(), 7);
+  EXPECT_EQ(result.GetCols(), 6);
+  EXPECT_TRUE(result.ToMatrix() == matrix_1 * matrix_2);
+  EXPECT_TRUE(S21DiskMatrix("ooc_c.bin").ToMatrix() == matrix_1 * matrix_2);
+  std::remove("ooc_a.bin");
+  std::remove("ooc_b.bin");
+  std::remove("ooc_c.bin");
+}
+
+TEST(OutOfCore, MulFail) {
+  S21DiskMatrix disk_1("ooc_a.bin", 2, 3);
+  S21DiskMatrix disk_2("ooc_b.bin", 2, 3);
+  S21DiskMatrix disk_3("ooc_c.bin", 3, 2);
+
+  EXPECT_ANY_THROW(MulMatrixOutOfCore(disk_1, disk_2, "ooc_d.bin", 1024));
+  EXPECT_ANY_THROW(MulMatrixOutOfCore(disk_1, disk_3, "ooc_d.bin", 1));
+  EXPECT_ANY_THROW(MulMatrixOutOfCore(disk_1, disk_3, "ooc_a.bin", 1024));
+
+  // Headers that do not fit an int, or disagree with the file size.
+  auto write_file = [](std::int64_t rows, std::int64_t cols, size_t cells) {
+    std::ofstream out("ooc_e.bin", std::ios::binary | std::ios::trunc);
+    std::int64_t header[2] = {rows, cols};
+    out.write(reinterpret_cast<const char *>(header), sizeof(header));
+    std::vector<double> data(cells);
+    out.write(reinterpret_cast<const char *>(data.data()),
+              data.size() * sizeof(double));
+  };
+  write_file(std::int64_t{1} << 32, 1, 1);
+  EXPECT_ANY_THROW(S21DiskMatrix("ooc_e.bin"));
+  write_file(2, std::int64_t{1} << 40, 2);
+  EXPECT_ANY_THROW(S21DiskMatrix("ooc_e.bin"));
+  write_file(3, 3, 8);
+  EXPECT_ANY_THROW(S21DiskMatrix("ooc_e.bin"));
+  write_file(3, 3, 10);
+  EXPECT_ANY_THROW(S21DiskMatrix("ooc_e.bin"));
+  write_file(3, 3, 9);
+  S21DiskMatrix disk_4("ooc_e.bin");
+  EXPECT_EQ(disk_4.GetRows(), 3);
+  EXPECT_NO_THROW(MulMatrixOutOfCore(disk_1, disk_4, "ooc_d.bin", 1024));
+  std::remove("ooc_d.bin");
+  std::remove("ooc_e.bin");
+  std::remove("ooc_a.bin");
+  std::remove("ooc_b.bin");
+  std::remove("ooc_c.bin");
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
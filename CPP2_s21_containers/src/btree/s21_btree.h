@@ -0,0 +1,228 @@
+#ifndef CPP2_S21_CONTAINERS_S21_BTREE_H_
+#define CPP2_S21_CONTAINERS_S21_BTREE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../pool/s21_node_pool.h"
+#include "../tree/s21_tree.h"
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+template <typename Value, size_t NodeBytes>
+struct BTreeInternal;
+
+// Node of btree holding up to kSlots values in place. Slot storage is raw,
+// values are constructed and destroyed by the tree. kSlots is chosen so a
+// node fills about NodeBytes, but never less than three values.
+template <typename Value, size_t NodeBytes>
+struct BTreeLeaf {
+  using Internal = BTreeInternal<Value, NodeBytes>;
+  static constexpr size_t kHeader = sizeof(void*) + 2 * sizeof(uint16_t) + 1;
+  static constexpr size_t kSlots =
+      NodeBytes > kHeader + 3 * sizeof(Value)
+          ? (NodeBytes - kHeader) / sizeof(Value)
+          : 3;
+  static_assert(kSlots < std::numeric_limits<uint16_t>::max(),
+                "Node is too large");
+
+  BTreeLeaf() {}  // leaves the slots uninitialized
+
+  BTreeLeaf* parent;
+  uint16_t position;  // index in parent->children
+  uint16_t count;
+  bool leaf;
+  alignas(Value) unsigned char storage[kSlots * sizeof(Value)];
+
+  Value& value(size_t i) { return reinterpret_cast<Value*>(storage)[i]; }
+};
+
+template <typename Value, size_t NodeBytes>
+struct BTreeInternal : BTreeLeaf<Value, NodeBytes> {
+  using Leaf = BTreeLeaf<Value, NodeBytes>;
+  BTreeInternal() {}
+
+  Leaf* children[Leaf::kSlots + 1];
+};
+
+// In-order iterator over btree. The past-the-end iterator is null, as in
+// tree, so iteration also stops at nullptr.
+template <typename Node, typename Value>
+class BTreeIterator {
+ public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = std::remove_const_t<Value>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = Value*;
+  using reference = Value&;
+
+  BTreeIterator() : node_(nullptr), pos_(0) {}
+  BTreeIterator(std::nullptr_t) : node_(nullptr), pos_(0) {}
+  BTreeIterator(Node* node, size_t pos) : node_(node), pos_(pos) {}
+  template <typename Other, typename = std::enable_if_t<
+                                std::is_same<const Other, Value>::value>>
+  BTreeIterator(const BTreeIterator<Node, Other>& other)
+      : node_(other.node_), pos_(other.pos_) {}
+
+  reference operator*() const {
+    if (!node_) throw std::runtime_error("Iterator is pointing to nullptr");
+    return node_->value(pos_);
+  }
+  pointer operator->() const { return &**this; }
+
+  BTreeIterator& operator++();
+  BTreeIterator operator++(int) {
+    BTreeIterator tmp(*this);
+    ++*this;
+    return tmp;
+  }
+  BTreeIterator& operator--();
+  BTreeIterator operator--(int) {
+    BTreeIterator tmp(*this);
+    --*this;
+    return tmp;
+  }
+
+  bool operator==(const BTreeIterator& other) const {
+    return node_ == other.node_ && pos_ == other.pos_;
+  }
+  bool operator!=(const BTreeIterator& other) const {
+    return !(*this == other);
+  }
+
+ private:
+  template <typename, typename>
+  friend class BTreeIterator;
+  template <typename, typename, size_t>
+  friend class btree;
+
+  Node* Child(size_t i) const {
+    return static_cast<typename Node::Internal*>(node_)->children[i];
+  }
+
+  Node* node_;
+  size_t pos_;
+};
+
+// B-tree with the container interface of tree, so that Set, Multiset and
+// Map can use it through their Container parameter. Many values share one
+// node, which makes lookups touch log_B(n) nodes instead of log_2(n) and
+// drops the per-element pointers. Inserts and erases invalidate iterators.
+template <typename Key, typename T, size_t NodeBytes = 256>
+class btree {
+  using Leaf = BTreeLeaf<T, NodeBytes>;
+  using Internal = BTreeInternal<T, NodeBytes>;
+
+ public:
+  using key_type = Key;
+  using value_type = T;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = BTreeIterator<Leaf, value_type>;
+  using const_iterator = BTreeIterator<Leaf, const value_type>;
+  using size_type = size_t;
+
+  btree();
+  btree(std::initializer_list<value_type> const& items);
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  btree(InputIt first, InputIt last);
+  btree(const btree& other);
+  btree(btree&& other);
+  ~btree();
+  btree& operator=(btree&& other);
+  btree& operator=(const btree& other);
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+  const_iterator cbegin() const;
+  const_iterator cend() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+
+  void clear();
+  std::pair<iterator, bool> insert(const value_type& value);
+  std::pair<iterator, bool> insert_unique(const value_type& value);
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> emplace_key(const K& key, Args&&... args);
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  void insert(InputIt first, InputIt last, bool unique = false);
+  void erase(iterator pos);
+  iterator erase(iterator first, iterator last);
+  void swap(btree& other);
+  void merge(btree& other, bool unique = true);
+  static btree Combine(const btree& a, const btree& b, SetOperation op);
+  static btree Combine(btree&& a, btree&& b, SetOperation op);
+
+  const_iterator find(const value_type& value) const;
+  template <typename K>
+  iterator find_key(const K& key) const;
+  bool contains(const Key& key) const;
+  template <typename K>
+  iterator lower_bound(const K& key) const;
+  template <typename K>
+  iterator upper_bound(const K& key) const;
+  template <typename K>
+  size_type count(const K& key) const;
+
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args);
+
+  static const Key& KeyOf(const value_type& value);
+
+ private:
+  static constexpr size_type kMaxValues = Leaf::kSlots;
+  static constexpr size_type kMinValues = kMaxValues / 2;
+
+  static Internal* AsInternal(Leaf* node) {
+    return static_cast<Internal*>(node);
+  }
+  static void Transfer(value_type* dst, value_type* src);
+  static void SetChild(Internal* node, size_type i, Leaf* child);
+  template <typename K>
+  static size_type LowerBound(Leaf* node, const K& key);
+  template <typename K>
+  static size_type UpperBound(Leaf* node, const K& key);
+
+  Leaf* NewNode(bool leaf);
+  void FreeNode(Leaf* node);
+  void DestroyValues(Leaf* node);
+  void OpenGap(Leaf* node, size_type i);
+  void CloseGap(Leaf* node, size_type i);
+  void Split(Leaf*& node, size_type& i);
+  template <typename... Args>
+  iterator InsertAt(Leaf* node, size_type i, Args&&... args);
+  template <typename V>
+  void Append(Leaf*& last, V&& value);
+  void Rebalance(Leaf* node);
+  void RotateLeft(Internal* parent, size_type i);
+  void RotateRight(Internal* parent, size_type i);
+  void MergeChildren(Internal* parent, size_type i);
+  template <typename Tree>
+  static btree CombineValues(Tree& a, Tree& b, SetOperation op);
+
+  Leaf* root_;
+  size_type size_;
+  NodePool<Leaf> leaves_;
+  NodePool<Internal> internals_;
+};
+
+}  // namespace s21
+
+#include "s21_btree.tpp"
+
+#endif  // CPP2_S21_CONTAINERS_S21_BTREE_H_
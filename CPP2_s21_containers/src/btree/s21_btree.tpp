@@ -0,0 +1,757 @@
+namespace s21 {
+
+////////////////////// ITERATOR
+
+template <typename Node, typename Value>
+BTreeIterator<Node, Value>& BTreeIterator<Node, Value>::operator++() {
+  if (!node_) return *this;
+  if (!node_->leaf) {
+    node_ = Child(pos_ + 1);
+    while (!node_->leaf) node_ = Child(0);
+    pos_ = 0;
+    return *this;
+  }
+  if (++pos_ < node_->count) return *this;
+  while (node_ && pos_ == node_->count) {
+    pos_ = node_->position;
+    node_ = node_->parent;
+  }
+  return *this;
+}
+
+template <typename Node, typename Value>
+BTreeIterator<Node, Value>& BTreeIterator<Node, Value>::operator--() {
+  if (!node_) return *this;
+  if (!node_->leaf) {
+    node_ = Child(pos_);
+    while (!node_->leaf) node_ = Child(node_->count);
+    pos_ = node_->count - 1;
+    return *this;
+  }
+  while (node_ && pos_ == 0) {
+    pos_ = node_->position;
+    node_ = node_->parent;
+  }
+  if (node_) --pos_;
+  return *this;
+}
+
+////////////////////// CONSTRUCTORS
+
+template <typename Key, typename T, size_t NodeBytes>
+btree<Key, T, NodeBytes>::btree() : root_(nullptr), size_(0) {}
+
+template <typename Key, typename T, size_t NodeBytes>
+btree<Key, T, NodeBytes>::btree(std::initializer_list<value_type> const& items)
+    : btree() {
+  insert(items.begin(), items.end());
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+template <typename InputIt, typename>
+btree<Key, T, NodeBytes>::btree(InputIt first, InputIt last) : btree() {
+  insert(first, last);
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+btree<Key, T, NodeBytes>::btree(const btree& other) : btree() {
+  Leaf* last = nullptr;
+  for (const value_type& value : other) Append(last, value);
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+btree<Key, T, NodeBytes>::btree(btree&& other) : btree() {
+  swap(other);
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+btree<Key, T, NodeBytes>::~btree() {
+  clear();
+}
+
+////////////////////// OPERATORS
+
+template <typename Key, typename T, size_t NodeBytes>
+btree<Key, T, NodeBytes>& btree<Key, T, NodeBytes>::operator=(btree&& other) {
+  if (this == &other) return *this;
+  clear();
+  swap(other);
+  return *this;
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+btree<Key, T, NodeBytes>& btree<Key, T, NodeBytes>::operator=(
+    const btree& other) {
+  if (this == &other) return *this;
+  btree tmp(other);
+  swap(tmp);
+  return *this;
+}
+
+////////////////////// PUBLIC FUNCTIONS
+
+template <typename Key, typename T, size_t NodeBytes>
+typename btree<Key, T, NodeBytes>::iterator btree<Key, T, NodeBytes>::begin() {
+  if (!root_) return end();
+  Leaf* node = root_;
+  while (!node->leaf) node = AsInternal(node)->children[0];
+  return iterator(node, 0);
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+typename btree<Key, T, NodeBytes>::iterator btree<Key, T, NodeBytes>::end() {
+  return iterator();
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+typename btree<Key, T, NodeBytes>::const_iterator
+btree<Key, T, NodeBytes>::begin() const {
+  return const_cast<btree*>(this)->begin();
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+typename btree<Key, T, NodeBytes>::const_iterator
+btree<Key, T, NodeBytes>::end() const {
+  return const_iterator();
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+typename btree<Key, T, NodeBytes>::const_iterator
+btree<Key, T, NodeBytes>::cbegin() const {
+  return begin();
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+typename btree<Key, T, NodeBytes>::const_iterator
+btree<Key, T, NodeBytes>::cend() const {
+  return end();
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+bool btree<Key, T, NodeBytes>::empty() const {
+  return size_ == 0;
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+typename btree<Key, T, NodeBytes>::size_type btree<Key, T, NodeBytes>::size()
+    const {
+  return size_;
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+typename btree<Key, T, NodeBytes>::size_type
+btree<Key, T, NodeBytes>::max_size() const {
+  return std::numeric_limits<size_type>::max() / sizeof(value_type);
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+void btree<Key, T, NodeBytes>::clear() {
+  if constexpr (!std::is_trivially_destructible<value_type>::value) {
+    if (root_) DestroyValues(root_);
+  }
+  leaves_.release();
+  internals_.release();
+  root_ = nullptr;
+  size_ = 0;
+}
+
+// Equal keys go after the existing ones, as in tree.
+template <typename Key, typename T, size_t NodeBytes>
+std::pair<typename btree<Key, T, NodeBytes>::iterator, bool>
+btree<Key, T, NodeBytes>::insert(const value_type& value) {
+  Leaf* node = root_;
+  size_type i = 0;
+  while (node) {
+    i = UpperBound(node, KeyOf(value));
+    if (node->leaf) break;
+    node = AsInternal(node)->children[i];
+  }
+  return std::pair<iterator, bool>(InsertAt(node, i, value), true);
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+std::pair<typename btree<Key, T, NodeBytes>::iterator, bool>
+btree<Key, T, NodeBytes>::insert_unique(const value_type& value) {
+  return emplace_key(KeyOf(value), value);
+}
+
+// Constructs value_type(args...) where key belongs unless key is present,
+// in the same descent that looks the key up.
+template <typename Key, typename T, size_t NodeBytes>
+template <typename K, typename... Args>
+std::pair<typename btree<Key, T, NodeBytes>::iterator, bool>
+btree<Key, T, NodeBytes>::emplace_key(const K& key, Args&&... args) {
+  Leaf* node = root_;
+  size_type i = 0;
+  while (node) {
+    i = LowerBound(node, key);
+    if (i < node->count && !(key < KeyOf(node->value(i)))) {
+      return std::pair<iterator, bool>(iterator(node, i), false);
+    }
+    if (node->leaf) break;
+    node = AsInternal(node)->children[i];
+  }
+  return std::pair<iterator, bool>(
+      InsertAt(node, i, std::forward<Args>(args)...), true);
+}
+
+// Small batches are inserted one by one. Larger ones are sorted and merged
+// with the current contents into a new tree in O(n + m), filling the nodes
+// left to right. The current values are copied rather than moved, so if a
+// copy or an allocation throws, the tree is left unchanged. With unique
+// set, keys that are already present, or repeated in the input, are
+// skipped.
+template <typename Key, typename T, size_t NodeBytes>
+template <typename InputIt, typename>
+void btree<Key, T, NodeBytes>::insert(InputIt first, InputIt last,
+                                      bool unique) {
+  std::vector<value_type> incoming(first, last);
+  if (incoming.empty()) return;
+  std::vector<value_type*> order;
+  order.reserve(incoming.size());
+  for (value_type& value : incoming) order.push_back(&value);
+  auto less = [](const value_type* a, const value_type* b) {
+    return KeyOf(*a) < KeyOf(*b);
+  };
+  if (!std::is_sorted(order.begin(), order.end(), less)) {
+    std::stable_sort(order.begin(), order.end(), less);
+  }
+  if (order.size() * 8 < size_) {
+    for (value_type* value : order) {
+      if (unique) {
+        insert_unique(*value);
+      } else {
+        insert(*value);
+      }
+    }
+    return;
+  }
+  btree res;
+  Leaf* tail = nullptr;
+  iterator iter = begin();
+  size_type j = 0;
+  while (iter != nullptr || j < order.size()) {
+    // On equal keys the existing value goes first.
+    bool existing = j == order.size() ||
+                    (iter != nullptr && !less(order[j], &*iter));
+    const value_type& next = existing ? *iter : *order[j];
+    if (!unique || !tail ||
+        KeyOf(tail->value(tail->count - 1)) < KeyOf(next)) {
+      if (existing) {
+        res.Append(tail, next);
+      } else {
+        res.Append(tail, std::move(*order[j]));
+      }
+    }
+    if (existing) {
+      ++iter;
+    } else {
+      ++j;
+    }
+  }
+  swap(res);
+}
+
+// Erasing from an internal node swaps in the in-order predecessor, so the
+// value is always removed from a leaf. Underfull nodes then borrow from a
+// sibling or are merged with it, bottom up.
+template <typename Key, typename T, size_t NodeBytes>
+void btree<Key, T, NodeBytes>::erase(iterator pos) {
+  Leaf* node = pos.node_;
+  size_type i = pos.pos_;
+  if (!node) return;
+  node->value(i).~value_type();
+  if (!node->leaf) {
+    Leaf* leaf = AsInternal(node)->children[i];
+    while (!leaf->leaf) leaf = AsInternal(leaf)->children[leaf->count];
+    Transfer(&node->value(i), &leaf->value(leaf->count - 1));
+    node = leaf;
+  } else {
+    CloseGap(node, i);
+  }
+  node->count--;
+  size_--;
+  Rebalance(node);
+}
+
+// Erases [first, last). A single erase may move values between nodes, so
+// after each one the next element is found again from the key of first
+// and its offset among the elements with that key.
+template <typename Key, typename T, size_t NodeBytes>
+typename btree<Key, T, NodeBytes>::iterator btree<Key, T, NodeBytes>::erase(
+    iterator first, iterator last) {
+  size_type count = 0;
+  for (iterator iter = first; iter != last; ++iter) count++;
+  if (count == 0) return last;
+  if (count == size_) {
+    clear();
+    return nullptr;
+  }
+  Key key = KeyOf(*first);
+  size_type offset = 0;
+  for (iterator iter = lower_bound(key); iter != first; ++iter) offset++;
+  iterator pos = first;
+  for (; count > 0; count--) {
+    erase(pos);
+    pos = lower_bound(key);
+    for (size_type i = 0; i < offset; i++) ++pos;
+  }
+  return pos;
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+void btree<Key, T, NodeBytes>::swap(btree& other) {
+  std::swap(root_, other.root_);
+  std::swap(size_, other.size_);
+  leaves_.swap(other.leaves_);
+  internals_.swap(other.internals_);
+}
+
+// Both trees are rebuilt in one ordered pass. Values move into fresh nodes;
+// with unique set, the ones whose key is already present stay in other.
+template <typename Key, typename T, size_t NodeBytes>
+void btree<Key, T, NodeBytes>::merge(btree& other, bool unique) {
+  if (this == &other || other.empty()) return;
+  if (empty()) {
+    swap(other);
+    return;
+  }
+  btree res, left;
+  Leaf *res_tail = nullptr, *left_tail = nullptr;
+  iterator a = begin(), b = other.begin();
+  while (a != nullptr || b != nullptr) {
+    if (b == nullptr || (a != nullptr && !(KeyOf(*b) < KeyOf(*a)))) {
+      if (unique && b != nullptr && !(KeyOf(*a) < KeyOf(*b))) {
+        left.Append(left_tail, std::move(*b++));
+      }
+      res.Append(res_tail, std::move(*a++));
+    } else {
+      res.Append(res_tail, std::move(*b++));
+    }
+  }
+  swap(res);
+  other.swap(left);
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+btree<Key, T, NodeBytes> btree<Key, T, NodeBytes>::Combine(const btree& a,
+                                                           const btree& b,
+                                                           SetOperation op) {
+  return CombineValues<const btree>(a, b, op);
+}
+
+// Moves the values instead of copying them; a and b are left empty.
+template <typename Key, typename T, size_t NodeBytes>
+btree<Key, T, NodeBytes> btree<Key, T, NodeBytes>::Combine(btree&& a,
+                                                           btree&& b,
+                                                           SetOperation op) {
+  btree res = CombineValues<btree>(a, b, op);
+  a.clear();
+  b.clear();
+  return res;
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+typename btree<Key, T, NodeBytes>::const_iterator
+btree<Key, T, NodeBytes>::find(const value_type& value) const {
+  return find_key(KeyOf(value));
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+template <typename K>
+typename btree<Key, T, NodeBytes>::iterator btree<Key, T, NodeBytes>::find_key(
+    const K& key) const {
+  Leaf* node = root_;
+  while (node) {
+    size_type i = LowerBound(node, key);
+    if (i < node->count && !(key < KeyOf(node->value(i)))) {
+      return iterator(node, i);
+    }
+    if (node->leaf) break;
+    node = AsInternal(node)->children[i];
+  }
+  return nullptr;
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+bool btree<Key, T, NodeBytes>::contains(const Key& key) const {
+  return find_key(key) != nullptr;
+}
+
+// The last node on the path whose bound lies inside it holds the answer;
+// null when key is past every element.
+template <typename Key, typename T, size_t NodeBytes>
+template <typename K>
+typename btree<Key, T, NodeBytes>::iterator
+btree<Key, T, NodeBytes>::lower_bound(const K& key) const {
+  iterator found;
+  Leaf* node = root_;
+  while (node) {
+    size_type i = LowerBound(node, key);
+    if (i < node->count) found = iterator(node, i);
+    if (node->leaf) break;
+    node = AsInternal(node)->children[i];
+  }
+  return found;
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+template <typename K>
+typename btree<Key, T, NodeBytes>::iterator
+btree<Key, T, NodeBytes>::upper_bound(const K& key) const {
+  iterator found;
+  Leaf* node = root_;
+  while (node) {
+    size_type i = UpperBound(node, key);
+    if (i < node->count) found = iterator(node, i);
+    if (node->leaf) break;
+    node = AsInternal(node)->children[i];
+  }
+  return found;
+}
+
+// O(log n + count): nodes keep no subtree sizes.
+template <typename Key, typename T, size_t NodeBytes>
+template <typename K>
+typename btree<Key, T, NodeBytes>::size_type btree<Key, T, NodeBytes>::count(
+    const K& key) const {
+  size_type n = 0;
+  for (iterator iter = lower_bound(key);
+       iter != nullptr && !(key < KeyOf(*iter)); ++iter) {
+    n++;
+  }
+  return n;
+}
+
+// Later inserts may move values between nodes, so only the last returned
+// iterator is guaranteed to stay valid.
+template <typename Key, typename T, size_t NodeBytes>
+template <typename... Args>
+s21::vector<std::pair<typename btree<Key, T, NodeBytes>::iterator, bool>>
+btree<Key, T, NodeBytes>::insert_many(Args&&... args) {
+  s21::vector<std::pair<iterator, bool>> my_vector;
+  for (auto i : {std::forward<Args>(args)...}) my_vector.push_back(insert(i));
+  return my_vector;
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+const Key& btree<Key, T, NodeBytes>::KeyOf(const value_type& value) {
+  if constexpr (std::is_same<Key, value_type>::value) {
+    return value;
+  } else {
+    return value.first;
+  }
+}
+
+////////////////////// PRIVATE FUNCTIONS
+
+template <typename Key, typename T, size_t NodeBytes>
+void btree<Key, T, NodeBytes>::Transfer(value_type* dst, value_type* src) {
+  new (dst) value_type(std::move(*src));
+  src->~value_type();
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+void btree<Key, T, NodeBytes>::SetChild(Internal* node, size_type i,
+                                        Leaf* child) {
+  node->children[i] = child;
+  child->parent = node;
+  child->position = static_cast<uint16_t>(i);
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+template <typename K>
+typename btree<Key, T, NodeBytes>::size_type
+btree<Key, T, NodeBytes>::LowerBound(Leaf* node, const K& key) {
+  size_type lo = 0, hi = node->count;
+  while (lo < hi) {
+    size_type mid = (lo + hi) / 2;
+    if (KeyOf(node->value(mid)) < key) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+template <typename K>
+typename btree<Key, T, NodeBytes>::size_type
+btree<Key, T, NodeBytes>::UpperBound(Leaf* node, const K& key) {
+  size_type lo = 0, hi = node->count;
+  while (lo < hi) {
+    size_type mid = (lo + hi) / 2;
+    if (key < KeyOf(node->value(mid))) {
+      hi = mid;
+    } else {
+      lo = mid + 1;
+    }
+  }
+  return lo;
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+typename btree<Key, T, NodeBytes>::Leaf* btree<Key, T, NodeBytes>::NewNode(
+    bool leaf) {
+  Leaf* node = leaf ? leaves_.create() : internals_.create();
+  node->parent = nullptr;
+  node->position = 0;
+  node->count = 0;
+  node->leaf = leaf;
+  return node;
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+void btree<Key, T, NodeBytes>::FreeNode(Leaf* node) {
+  if (node->leaf) {
+    leaves_.destroy(node);
+  } else {
+    internals_.destroy(AsInternal(node));
+  }
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+void btree<Key, T, NodeBytes>::DestroyValues(Leaf* node) {
+  for (size_type i = 0; i < node->count; i++) node->value(i).~value_type();
+  if (node->leaf) return;
+  for (size_type i = 0; i <= node->count; i++) {
+    DestroyValues(AsInternal(node)->children[i]);
+  }
+}
+
+// Shifts values from i, and children from i + 1, one slot to the right.
+template <typename Key, typename T, size_t NodeBytes>
+void btree<Key, T, NodeBytes>::OpenGap(Leaf* node, size_type i) {
+  if constexpr (std::is_trivially_copyable<value_type>::value) {
+    std::memmove(static_cast<void*>(&node->value(i + 1)), &node->value(i),
+                 (node->count - i) * sizeof(value_type));
+  } else {
+    for (size_type j = node->count; j > i; j--) {
+      Transfer(&node->value(j), &node->value(j - 1));
+    }
+  }
+  if (node->leaf) return;
+  Internal* internal = AsInternal(node);
+  for (size_type j = node->count + 1; j > i + 1; j--) {
+    SetChild(internal, j, internal->children[j - 1]);
+  }
+}
+
+// Inverse of OpenGap: value i must already be destroyed or moved out.
+template <typename Key, typename T, size_t NodeBytes>
+void btree<Key, T, NodeBytes>::CloseGap(Leaf* node, size_type i) {
+  if constexpr (std::is_trivially_copyable<value_type>::value) {
+    std::memmove(static_cast<void*>(&node->value(i)), &node->value(i + 1),
+                 (node->count - i - 1) * sizeof(value_type));
+  } else {
+    for (size_type j = i + 1; j < node->count; j++) {
+      Transfer(&node->value(j - 1), &node->value(j));
+    }
+  }
+  if (node->leaf) return;
+  Internal* internal = AsInternal(node);
+  for (size_type j = i + 2; j <= node->count; j++) {
+    SetChild(internal, j - 1, internal->children[j]);
+  }
+}
+
+// Splits a full node around a median that moves up to the parent, splitting
+// the parent first if needed. The split is biased towards the insert
+// position i: appending leaves the left node full, which keeps sorted
+// loads dense. On return node and i point to where the insert goes.
+template <typename Key, typename T, size_t NodeBytes>
+void btree<Key, T, NodeBytes>::Split(Leaf*& node, size_type& i) {
+  size_type count = node->count;
+  size_type mid = i == 0 ? 0 : i == count ? count - 1 : count / 2;
+  if (!node->parent) {
+    Internal* root = AsInternal(NewNode(false));
+    SetChild(root, 0, node);
+    root_ = root;
+  } else if (node->parent->count == kMaxValues) {
+    Leaf* parent = node->parent;
+    size_type pos = node->position;
+    Split(parent, pos);
+  }
+  Internal* parent = AsInternal(node->parent);
+  size_type pos = node->position;
+  Leaf* sibling = NewNode(node->leaf);
+  for (size_type j = mid + 1; j < count; j++) {
+    Transfer(&sibling->value(j - mid - 1), &node->value(j));
+  }
+  if (!node->leaf) {
+    for (size_type j = mid + 1; j <= count; j++) {
+      SetChild(AsInternal(sibling), j - mid - 1, AsInternal(node)->children[j]);
+    }
+  }
+  sibling->count = static_cast<uint16_t>(count - mid - 1);
+  OpenGap(parent, pos);
+  Transfer(&parent->value(pos), &node->value(mid));
+  SetChild(parent, pos + 1, sibling);
+  parent->count++;
+  node->count = static_cast<uint16_t>(mid);
+  if (i > mid) {
+    node = sibling;
+    i -= mid + 1;
+  }
+}
+
+// The value is built first, since the arguments may refer to an element of
+// this tree that the split or the shift below would move.
+template <typename Key, typename T, size_t NodeBytes>
+template <typename... Args>
+typename btree<Key, T, NodeBytes>::iterator btree<Key, T, NodeBytes>::InsertAt(
+    Leaf* node, size_type i, Args&&... args) {
+  value_type tmp(std::forward<Args>(args)...);
+  if (!node) {
+    node = root_ = NewNode(true);
+    i = 0;
+  }
+  if (node->count == kMaxValues) Split(node, i);
+  OpenGap(node, i);
+  try {
+    new (&node->value(i)) value_type(std::move(tmp));
+  } catch (...) {
+    CloseGap(node, i);
+    throw;
+  }
+  node->count++;
+  size_++;
+  return iterator(node, i);
+}
+
+// Appends a value greater than or equal to all others. last tracks the
+// rightmost leaf between calls; it starts out null on an empty tree.
+template <typename Key, typename T, size_t NodeBytes>
+template <typename V>
+void btree<Key, T, NodeBytes>::Append(Leaf*& last, V&& value) {
+  if (!last) last = root_ = NewNode(true);
+  size_type i = last->count;
+  if (i == kMaxValues) Split(last, i);
+  new (&last->value(i)) value_type(std::forward<V>(value));
+  last->count++;
+  size_++;
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+void btree<Key, T, NodeBytes>::Rebalance(Leaf* node) {
+  while (node != root_ && node->count < kMinValues) {
+    Internal* parent = AsInternal(node->parent);
+    size_type pos = node->position;
+    Leaf* left = pos > 0 ? parent->children[pos - 1] : nullptr;
+    Leaf* right = pos < parent->count ? parent->children[pos + 1] : nullptr;
+    if (left && left->count > kMinValues) {
+      RotateRight(parent, pos - 1);
+      return;
+    }
+    if (right && right->count > kMinValues) {
+      RotateLeft(parent, pos);
+      return;
+    }
+    MergeChildren(parent, left ? pos - 1 : pos);
+    node = parent;
+  }
+  if (node == root_ && !root_->count) {
+    if (root_->leaf) {
+      root_ = nullptr;
+    } else {
+      root_ = AsInternal(node)->children[0];
+      root_->parent = nullptr;
+      root_->position = 0;
+    }
+    FreeNode(node);
+  }
+}
+
+// Moves the first value of child i + 1 through the parent into child i.
+template <typename Key, typename T, size_t NodeBytes>
+void btree<Key, T, NodeBytes>::RotateLeft(Internal* parent, size_type i) {
+  Leaf* left = parent->children[i];
+  Leaf* right = parent->children[i + 1];
+  Transfer(&left->value(left->count), &parent->value(i));
+  Transfer(&parent->value(i), &right->value(0));
+  if (!left->leaf) {
+    SetChild(AsInternal(left), left->count + 1, AsInternal(right)->children[0]);
+  }
+  if (!right->leaf) {
+    // CloseGap only shifts the children after the gap.
+    Internal* internal = AsInternal(right);
+    SetChild(internal, 0, internal->children[1]);
+  }
+  CloseGap(right, 0);
+  left->count++;
+  right->count--;
+}
+
+// Moves the last value of child i through the parent into child i + 1.
+template <typename Key, typename T, size_t NodeBytes>
+void btree<Key, T, NodeBytes>::RotateRight(Internal* parent, size_type i) {
+  Leaf* left = parent->children[i];
+  Leaf* right = parent->children[i + 1];
+  OpenGap(right, 0);
+  Transfer(&right->value(0), &parent->value(i));
+  Transfer(&parent->value(i), &left->value(left->count - 1));
+  if (!right->leaf) {
+    // OpenGap only shifts the children after the gap.
+    Internal* internal = AsInternal(right);
+    SetChild(internal, 1, internal->children[0]);
+    SetChild(internal, 0, AsInternal(left)->children[left->count]);
+  }
+  left->count--;
+  right->count++;
+}
+
+// Joins child i, the separator and child i + 1 into child i.
+template <typename Key, typename T, size_t NodeBytes>
+void btree<Key, T, NodeBytes>::MergeChildren(Internal* parent, size_type i) {
+  Leaf* left = parent->children[i];
+  Leaf* right = parent->children[i + 1];
+  size_type base = left->count + 1;
+  Transfer(&left->value(left->count), &parent->value(i));
+  for (size_type j = 0; j < right->count; j++) {
+    Transfer(&left->value(base + j), &right->value(j));
+  }
+  if (!left->leaf) {
+    for (size_type j = 0; j <= right->count; j++) {
+      SetChild(AsInternal(left), base + j, AsInternal(right)->children[j]);
+    }
+  }
+  left->count = static_cast<uint16_t>(base + right->count);
+  CloseGap(parent, i);
+  parent->count--;
+  FreeNode(right);
+}
+
+template <typename Key, typename T, size_t NodeBytes>
+template <typename Tree>
+btree<Key, T, NodeBytes> btree<Key, T, NodeBytes>::CombineValues(
+    Tree& a, Tree& b, SetOperation op) {
+  // Copies from const trees, moves otherwise.
+  using Ref = std::conditional_t<std::is_const<Tree>::value,
+                                 const value_type&, value_type&&>;
+  bool keep_a = op != SetOperation::kIntersection;
+  bool keep_b = op == SetOperation::kUnion;
+  bool keep_common = op != SetOperation::kDifference;
+  btree res;
+  Leaf* tail = nullptr;
+  auto ia = a.begin();
+  auto ib = b.begin();
+  while (ia != nullptr && ib != nullptr) {
+    if (KeyOf(*ia) < KeyOf(*ib)) {
+      if (keep_a) res.Append(tail, static_cast<Ref>(*ia));
+      ++ia;
+    } else if (KeyOf(*ib) < KeyOf(*ia)) {
+      if (keep_b) res.Append(tail, static_cast<Ref>(*ib));
+      ++ib;
+    } else {
+      if (keep_common) res.Append(tail, static_cast<Ref>(*ia));
+      ++ia;
+      ++ib;
+    }
+  }
+  for (; keep_a && ia != nullptr; ++ia) res.Append(tail, static_cast<Ref>(*ia));
+  for (; keep_b && ib != nullptr; ++ib) res.Append(tail, static_cast<Ref>(*ib));
+  return res;
+}
+
+}  // namespace s21
@@ -0,0 +1,181 @@
+#ifndef CPP2_S21_CONTAINERS_S21_CONCURRENT_MAP_H_
+#define CPP2_S21_CONTAINERS_S21_CONCURRENT_MAP_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <utility>
+
+#include "../hash/s21_hash_table.h"
+#include "../tree/s21_tree.h"
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+// Ordered map safe to share between threads. Keys are spread by hash over
+// a power-of-two number of shards, each an ordered Container behind its
+// own reader-writer lock, so lookups on different shards never contend
+// and lookups on the same shard share it. Operations that need the whole
+// map take every shard lock in index order; snapshot() copies the entries
+// under those locks, merges the sorted shards and returns a consistent,
+// key-ordered copy.
+template <typename Key, typename T,
+          typename Container = tree<Key, std::pair<const Key, T>>,
+          typename Hash = std::hash<Key>>
+class concurrent_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using size_type = size_t;
+
+  explicit concurrent_map(size_type shards = 64, const Hash& hash = Hash())
+      : shards_(nullptr), mask_(0), hash_(hash) {
+    size_type count = 1;
+    while (count < shards && count < kMaxShards) count *= 2;
+    shards_ = new Shard[count];
+    mask_ = count - 1;
+  }
+
+  concurrent_map(const concurrent_map&) = delete;
+  concurrent_map& operator=(const concurrent_map&) = delete;
+  ~concurrent_map() { delete[] shards_; }
+
+  size_type shard_count() const { return mask_ + 1; }
+
+  // Returns true when the key was inserted, false when it already existed.
+  bool insert(const Key& key, const T& obj) {
+    Shard& shard = ShardOf(key);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.values.emplace_key(key, key, obj).second;
+  }
+
+  bool insert_or_assign(const Key& key, const T& obj) {
+    Shard& shard = ShardOf(key);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    auto pair = shard.values.emplace_key(key, key, obj);
+    if (!pair.second) (*pair.first).second = obj;
+    return pair.second;
+  }
+
+  bool erase(const Key& key) {
+    Shard& shard = ShardOf(key);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    auto iter = shard.values.find_key(key);
+    if (iter == nullptr) return false;
+    shard.values.erase(iter);
+    return true;
+  }
+
+  bool contains(const Key& key) const {
+    Shard& shard = ShardOf(key);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.values.find_key(key) != nullptr;
+  }
+
+  // Returns a copy: a reference would outlive the shard lock.
+  T at(const Key& key) const {
+    Shard& shard = ShardOf(key);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    auto iter = shard.values.find_key(key);
+    if (iter == nullptr) throw std::out_of_range("Key is not in the map");
+    return (*iter).second;
+  }
+
+  size_type size() const {
+    size_type total = 0;
+    ForEachShardLocked([&total](Shard& shard) {
+      total += shard.values.size();
+    });
+    return total;
+  }
+
+  bool empty() const { return size() == 0; }
+
+  void clear() {
+    for (size_type i = 0; i <= mask_; i++) {
+      std::unique_lock<std::shared_mutex> lock(shards_[i].mutex);
+      shards_[i].values.clear();
+    }
+  }
+
+  // All entries as of one instant, in key order.
+  s21::vector<std::pair<Key, T>> snapshot() const {
+    return Collect(nullptr, nullptr);
+  }
+
+  // Entries with keys in [first, last) as of one instant, in key order.
+  // Each shard is read from lower_bound(first) on, so the cost follows the
+  // size of the range, not of the map.
+  s21::vector<std::pair<Key, T>> snapshot(const Key& first,
+                                          const Key& last) const {
+    return Collect(&first, &last);
+  }
+
+ private:
+  static constexpr size_type kMaxShards = 1024;
+
+  // Aligned so that two shard locks never share a cache line.
+  struct alignas(64) Shard {
+    std::shared_mutex mutex;
+    Container values;
+  };
+
+  Shard& ShardOf(const Key& key) const {
+    return shards_[hash_detail::Mix(hash_(key)) & mask_];
+  }
+
+  // Calls f on every shard while holding all of them for reading.
+  template <typename F>
+  void ForEachShardLocked(F f) const {
+    s21::vector<std::shared_lock<std::shared_mutex>> locks;
+    locks.reserve(mask_ + 1);
+    for (size_type i = 0; i <= mask_; i++) {
+      locks.emplace_back(shards_[i].mutex);
+    }
+    for (size_type i = 0; i <= mask_; i++) f(shards_[i]);
+  }
+
+  // Copies the entries in [*first, *last) of every shard, each already
+  // sorted, then merges the sorted runs pairwise. A null bound leaves that
+  // side of the range open.
+  s21::vector<std::pair<Key, T>> Collect(const Key* first,
+                                         const Key* last) const {
+    s21::vector<std::pair<Key, T>> out;
+    s21::vector<size_type> runs;
+    ForEachShardLocked([&out, &runs, first, last](Shard& shard) {
+      runs.push_back(out.size());
+      // An empty tree's begin() is its end sentinel, not nullptr.
+      if (shard.values.empty()) return;
+      auto iter = first ? shard.values.lower_bound(*first)
+                        : shard.values.begin();
+      for (; iter != nullptr && (!last || (*iter).first < *last); ++iter) {
+        out.emplace_back((*iter).first, (*iter).second);
+      }
+    });
+    runs.push_back(out.size());
+    auto less = [](const std::pair<Key, T>& a, const std::pair<Key, T>& b) {
+      return a.first < b.first;
+    };
+    for (size_type width = 1; width + 1 < runs.size(); width *= 2) {
+      for (size_type i = 0; i + width + 1 < runs.size(); i += 2 * width) {
+        size_type end = std::min(i + 2 * width, runs.size() - 1);
+        std::inplace_merge(out.begin() + runs[i],
+                           out.begin() + runs[i + width],
+                           out.begin() + runs[end], less);
+      }
+    }
+    return out;
+  }
+
+  Shard* shards_;
+  size_type mask_;
+  Hash hash_;
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_CONCURRENT_MAP_H_
@@ -0,0 +1,17 @@
+#ifndef CPP2_S21_CONTAINERS_S21_COUNTED_MULTISET_H_
+#define CPP2_S21_CONTAINERS_S21_COUNTED_MULTISET_H_
+
+#include "../counted_tree/s21_counted_tree.h"
+#include "../multiset/s21_multiset.h"
+
+namespace s21 {
+
+// Multiset that stores each distinct key once, with the number of its
+// copies. Memory and the cost of insert and erase depend on the number of
+// distinct keys only, which suits histograms with many repeated keys.
+template <typename Key>
+using counted_multiset = Multiset<Key, counted_tree<Key>>;
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_COUNTED_MULTISET_H_
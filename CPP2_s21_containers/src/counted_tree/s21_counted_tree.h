@@ -0,0 +1,335 @@
+#ifndef CPP2_S21_CONTAINERS_S21_COUNTED_TREE_H_
+#define CPP2_S21_CONTAINERS_S21_COUNTED_TREE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "../tree/s21_tree.h"
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+// One node of counted_tree: a key and the number of its copies. The
+// members are named as in std::pair, which is what tree::KeyOf reads.
+template <typename Key>
+struct CountedRun {
+  CountedRun() : first(), second(0) {}
+  CountedRun(const Key& key, size_t count) : first(key), second(count) {}
+
+  Key first;
+  size_t second;
+};
+
+}  // namespace s21
+
+// A run counts as all of its copies, so subtree sizes, nth() and rank()
+// of the underlying tree work in elements rather than in nodes.
+template <typename Key>
+struct NodeWeight<s21::CountedRun<Key>> {
+  static size_t Of(const s21::CountedRun<Key>& run) { return run.second; }
+};
+
+namespace s21 {
+
+// Iterator over counted_tree: a node and the index of a copy within its
+// run, so that every copy is visited. It becomes null past the last copy,
+// so iteration stops at nullptr as with tree.
+template <typename Key>
+class CountedIterator {
+ public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = Key;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const Key*;
+  using reference = const Key&;
+
+  CountedIterator() : node_(nullptr), index_(0) {}
+  CountedIterator(std::nullptr_t) : CountedIterator() {}
+
+  reference operator*() const {
+    if (!node_) throw std::runtime_error("Iterator is pointing to nullptr");
+    return node_->data.first;
+  }
+  pointer operator->() const { return &**this; }
+
+  CountedIterator& operator++() {
+    if (node_ && ++index_ == node_->data.second) {
+      TreeIterator<Key, CountedRun<Key>> next(node_);
+      node_ = (++next).unit;
+      index_ = 0;
+    }
+    return *this;
+  }
+  CountedIterator operator++(int) {
+    CountedIterator tmp(*this);
+    ++*this;
+    return tmp;
+  }
+  CountedIterator& operator--() {
+    if (!node_) return *this;
+    if (index_ > 0) {
+      index_--;
+    } else {
+      TreeIterator<Key, CountedRun<Key>> prev(node_);
+      node_ = (--prev).unit;
+      if (node_) index_ = node_->data.second - 1;
+    }
+    return *this;
+  }
+  CountedIterator operator--(int) {
+    CountedIterator tmp(*this);
+    --*this;
+    return tmp;
+  }
+
+  bool operator==(const CountedIterator& other) const {
+    return node_ == other.node_ && index_ == other.index_;
+  }
+  bool operator!=(const CountedIterator& other) const {
+    return !(*this == other);
+  }
+
+ private:
+  template <typename>
+  friend class counted_tree;
+
+  CountedIterator(TreeNode<Key, CountedRun<Key>>* node, size_t index)
+      : node_(node), index_(node ? index : 0) {}
+
+  TreeNode<Key, CountedRun<Key>>* node_;
+  size_t index_;
+};
+
+// Run-length container with the interface Multiset expects of tree: equal
+// keys share one node that counts them. Adding or removing a copy of a key
+// already present updates the count and the subtree sizes on the path to
+// the root in O(log k), k being the number of distinct keys, without
+// allocating or rebalancing. Iteration still yields every copy.
+template <typename Key>
+class counted_tree {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = const value_type&;
+  using const_reference = const value_type&;
+  using iterator = CountedIterator<Key>;
+  using const_iterator = CountedIterator<Key>;
+  using size_type = size_t;
+
+  counted_tree() {}
+  counted_tree(std::initializer_list<value_type> const& items)
+      : counted_tree(items.begin(), items.end()) {}
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  counted_tree(InputIt first, InputIt last) {
+    insert(first, last);
+  }
+
+  iterator begin() const {
+    Node* node = runs_.root_;
+    while (node && node->left) node = node->left;
+    return iterator(node, 0);
+  }
+  iterator end() const { return iterator(); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+  bool empty() const { return runs_.root_ == nullptr; }
+  size_type size() const { return Runs::SubtreeSize(runs_.root_); }
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max();
+  }
+
+  void clear() { runs_.clear(); }
+
+  // Adds one copy, after the copies already present.
+  std::pair<iterator, bool> insert(const value_type& key) {
+    Node* node = Add(key, 1);
+    return {iterator(node, node->data.second - 1), true};
+  }
+
+  // Consecutive equal keys, common in histogram input, are added to the
+  // same node without searching for it again.
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  void insert(InputIt first, InputIt last, bool unique = false) {
+    Node* node = nullptr;
+    for (; first != last; ++first) {
+      if (node && !(node->data.first < *first) &&
+          !(*first < node->data.first)) {
+        if (!unique) Resize(node, 1, true);
+      } else if (!unique || !contains(*first)) {
+        node = Add(*first, 1);
+      } else {
+        node = runs_.find_key(*first).unit;
+      }
+    }
+  }
+
+  // Removes the copy at pos; its node goes when the last copy does.
+  void erase(iterator pos) {
+    if (!pos.node_) return;
+    if (pos.node_->data.second == 1) {
+      runs_.erase(typename Runs::iterator(pos.node_));
+    } else {
+      Resize(pos.node_, 1, false);
+    }
+  }
+
+  // Erases [first, last) in O(log k) per node it touches and returns the
+  // element after it. Runs covered whole are unlinked, partial ones
+  // shrink.
+  iterator erase(iterator first, iterator last) {
+    while (first != last && first.node_) {
+      Node* node = first.node_;
+      if (node == last.node_) {
+        Resize(node, last.index_ - first.index_, false);
+        return first;
+      }
+      TreeIterator<Key, CountedRun<Key>> next(node);
+      ++next;
+      if (first.index_ == 0) {
+        runs_.erase(typename Runs::iterator(node));
+      } else {
+        Resize(node, node->data.second - first.index_, false);
+      }
+      first = iterator(next.unit, 0);
+    }
+    return first;
+  }
+
+  void swap(counted_tree& other) { runs_.swap(other.runs_); }
+
+  // Moves every copy of other into this tree. With unique set only one
+  // copy of an absent key moves and the rest stay in other.
+  void merge(counted_tree& other, bool unique = true) {
+    if (this == &other) return;
+    counted_tree rest;
+    for (Node* node = other.begin().node_; node; node = Next(node)) {
+      const Key& key = node->data.first;
+      size_type count = node->data.second;
+      size_type moved = count;
+      if (unique) moved = contains(key) ? 0 : 1;
+      if (moved) Add(key, moved);
+      if (moved < count) rest.Add(key, count - moved);
+    }
+    other.swap(rest);
+  }
+
+  // Set algebra run by run in O(k + l): the counts of a key are combined
+  // as max, min or clamped difference, as with tree::Combine.
+  static counted_tree Combine(const counted_tree& a, const counted_tree& b,
+                              SetOperation op) {
+    s21::vector<CountedRun<Key>> runs;
+    Node* x = a.begin().node_;
+    Node* y = b.begin().node_;
+    while (x || y) {
+      if (y == nullptr || (x && x->data.first < y->data.first)) {
+        if (op != SetOperation::kIntersection) runs.push_back(x->data);
+        x = Next(x);
+      } else if (x == nullptr || y->data.first < x->data.first) {
+        if (op == SetOperation::kUnion) runs.push_back(y->data);
+        y = Next(y);
+      } else {
+        size_type n = x->data.second, m = y->data.second;
+        size_type count = std::max(n, m);
+        if (op == SetOperation::kIntersection) count = std::min(n, m);
+        if (op == SetOperation::kDifference) count = n > m ? n - m : 0;
+        if (count) runs.emplace_back(x->data.first, count);
+        x = Next(x);
+        y = Next(y);
+      }
+    }
+    counted_tree res;
+    res.runs_.insert(runs.begin(), runs.end());
+    return res;
+  }
+
+  // Runs are small, so the rvalue overload copies them as well; a and b
+  // are left empty.
+  static counted_tree Combine(counted_tree&& a, counted_tree&& b,
+                              SetOperation op) {
+    counted_tree res = Combine(a, b, op);
+    a.clear();
+    b.clear();
+    return res;
+  }
+
+  // The first copy of key, or null.
+  const_iterator find(const Key& key) const {
+    return iterator(runs_.find_key(key).unit, 0);
+  }
+  bool contains(const Key& key) const {
+    return runs_.find_key(key) != nullptr;
+  }
+
+  template <typename K>
+  iterator lower_bound(const K& key) const {
+    return iterator(runs_.lower_bound(key).unit, 0);
+  }
+  template <typename K>
+  iterator upper_bound(const K& key) const {
+    return iterator(runs_.upper_bound(key).unit, 0);
+  }
+  template <typename K>
+  size_type count(const K& key) const {
+    Node* node = runs_.find_key(key).unit;
+    return node ? node->data.second : 0;
+  }
+
+  // Order statistics over copies, through the weighted subtree sizes.
+  iterator nth(size_type k) const {
+    Node* node = runs_.Select(k);
+    return iterator(node, k);
+  }
+  template <typename K>
+  size_type rank(const K& key) const {
+    return runs_.rank(key);
+  }
+
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    s21::vector<std::pair<iterator, bool>> result;
+    for (auto key : {std::forward<Args>(args)...}) {
+      result.push_back(insert(key));
+    }
+    return result;
+  }
+
+ private:
+  using Node = TreeNode<Key, CountedRun<Key>>;
+  using Runs = tree<Key, CountedRun<Key>>;
+
+  static Node* Next(Node* node) {
+    TreeIterator<Key, CountedRun<Key>> iter(node);
+    return (++iter).unit;
+  }
+
+  // Adds count copies of key and returns its node.
+  Node* Add(const Key& key, size_type count) {
+    auto pair = runs_.emplace_key(key, key, count);
+    if (!pair.second) Resize(pair.first.unit, count, true);
+    return pair.first.unit;
+  }
+
+  // Changes the count of node by delta and fixes the subtree sizes above.
+  static void Resize(Node* node, size_type delta, bool grow) {
+    if (grow) {
+      node->data.second += delta;
+    } else {
+      node->data.second -= delta;
+    }
+    for (; node; node = node->parent) {
+      node->size = grow ? node->size + delta : node->size - delta;
+    }
+  }
+
+  Runs runs_;
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_COUNTED_TREE_H_
@@ -0,0 +1,176 @@
+#ifndef CPP2_S21_CONTAINERS_S21_FLAT_TREE_H_
+#define CPP2_S21_CONTAINERS_S21_FLAT_TREE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../tree/s21_tree.h"
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+// Iterator over the sorted array of flat_tree. As with tree, it becomes
+// null when it steps off either end, so iteration also stops at nullptr.
+template <typename Value>
+class FlatIterator {
+ public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = std::remove_const_t<Value>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = Value*;
+  using reference = Value&;
+
+  FlatIterator() : ptr_(nullptr), first_(nullptr), last_(nullptr) {}
+  FlatIterator(std::nullptr_t) : FlatIterator() {}
+  FlatIterator(Value* ptr, Value* first, Value* last)
+      : ptr_(ptr == last ? nullptr : ptr), first_(first), last_(last) {}
+  template <typename Other, typename = std::enable_if_t<
+                                std::is_same<const Other, Value>::value>>
+  FlatIterator(const FlatIterator<Other>& other)
+      : ptr_(other.ptr_), first_(other.first_), last_(other.last_) {}
+
+  reference operator*() const {
+    if (!ptr_) throw std::runtime_error("Iterator is pointing to nullptr");
+    return *ptr_;
+  }
+  pointer operator->() const { return &**this; }
+
+  FlatIterator& operator++() {
+    if (ptr_ && ++ptr_ == last_) ptr_ = nullptr;
+    return *this;
+  }
+  FlatIterator operator++(int) {
+    FlatIterator tmp(*this);
+    ++*this;
+    return tmp;
+  }
+  FlatIterator& operator--() {
+    if (ptr_) ptr_ = ptr_ == first_ ? nullptr : ptr_ - 1;
+    return *this;
+  }
+  FlatIterator operator--(int) {
+    FlatIterator tmp(*this);
+    --*this;
+    return tmp;
+  }
+
+  bool operator==(const FlatIterator& other) const {
+    return ptr_ == other.ptr_;
+  }
+  bool operator!=(const FlatIterator& other) const {
+    return ptr_ != other.ptr_;
+  }
+
+ private:
+  template <typename>
+  friend class FlatIterator;
+  template <typename, typename>
+  friend class flat_tree;
+
+  Value* ptr_;
+  Value* first_;
+  Value* last_;
+};
+
+// Sorted array with the container interface of tree, so that Set, Multiset
+// and Map can use it through their Container parameter. Lookups are a
+// branchless binary search over contiguous values, while single inserts and
+// erases shift the tail: it is meant for tables that are built once and
+// read many times. Bulk inserts sort the new values and merge them in one
+// pass. Inserts and erases invalidate iterators.
+template <typename Key, typename T>
+class flat_tree {
+ public:
+  using key_type = Key;
+  using value_type = T;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using iterator = FlatIterator<value_type>;
+  using const_iterator = FlatIterator<const value_type>;
+  using size_type = size_t;
+
+  flat_tree() {}
+  flat_tree(std::initializer_list<value_type> const& items);
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  flat_tree(InputIt first, InputIt last);
+  flat_tree(const flat_tree& other) : values_(other.values_) {}
+  flat_tree(flat_tree&& other) : values_(std::move(other.values_)) {}
+  flat_tree& operator=(flat_tree&& other);
+  flat_tree& operator=(const flat_tree& other);
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+  const_iterator cbegin() const;
+  const_iterator cend() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+
+  void clear();
+  std::pair<iterator, bool> insert(const value_type& value);
+  std::pair<iterator, bool> insert_unique(const value_type& value);
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> emplace_key(const K& key, Args&&... args);
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  void insert(InputIt first, InputIt last, bool unique = false);
+  void erase(iterator pos);
+  iterator erase(iterator first, iterator last);
+  void swap(flat_tree& other);
+  void merge(flat_tree& other, bool unique = true);
+  static flat_tree Combine(const flat_tree& a, const flat_tree& b,
+                           SetOperation op);
+  static flat_tree Combine(flat_tree&& a, flat_tree&& b, SetOperation op);
+
+  const_iterator find(const value_type& value) const;
+  template <typename K>
+  iterator find_key(const K& key) const;
+  bool contains(const Key& key) const;
+  template <typename K>
+  iterator lower_bound(const K& key) const;
+  template <typename K>
+  iterator upper_bound(const K& key) const;
+  template <typename K>
+  size_type count(const K& key) const;
+
+  iterator nth(size_type k) const;
+  template <typename K>
+  size_type rank(const K& key) const;
+
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args);
+
+  static const Key& KeyOf(const value_type& value);
+
+ private:
+  static bool Less(const value_type& a, const value_type& b) {
+    return KeyOf(a) < KeyOf(b);
+  }
+  // Lookups are const but hand out mutable iterators, as tree::find_key.
+  value_type* Data() const { return const_cast<value_type*>(values_.data()); }
+  iterator At(size_type i) const;
+  template <typename K>
+  size_type LowerBound(const K& key) const;
+  template <typename K>
+  size_type UpperBound(const K& key) const;
+  template <typename... Args>
+  void InsertAt(size_type i, Args&&... args);
+  template <typename Tree>
+  static flat_tree CombineValues(Tree& a, Tree& b, SetOperation op);
+  void Truncate(size_type n);
+
+  s21::vector<value_type> values_;
+};
+
+}  // namespace s21
+
+#include "s21_flat_tree.tpp"
+
+#endif  // CPP2_S21_CONTAINERS_S21_FLAT_TREE_H_
@@ -0,0 +1,372 @@
+namespace s21 {
+
+////////////////////// CONSTRUCTORS
+
+template <typename Key, typename T>
+flat_tree<Key, T>::flat_tree(std::initializer_list<value_type> const& items) {
+  insert(items.begin(), items.end());
+}
+
+template <typename Key, typename T>
+template <typename InputIt, typename>
+flat_tree<Key, T>::flat_tree(InputIt first, InputIt last) {
+  insert(first, last);
+}
+
+////////////////////// OPERATORS
+
+template <typename Key, typename T>
+flat_tree<Key, T>& flat_tree<Key, T>::operator=(flat_tree&& other) {
+  if (this == &other) return *this;
+  s21::vector<value_type> tmp;
+  tmp.swap(other.values_);
+  values_.swap(tmp);
+  return *this;
+}
+
+template <typename Key, typename T>
+flat_tree<Key, T>& flat_tree<Key, T>::operator=(const flat_tree& other) {
+  if (this == &other) return *this;
+  s21::vector<value_type> tmp(other.values_);
+  values_.swap(tmp);
+  return *this;
+}
+
+////////////////////// ITERATORS
+
+template <typename Key, typename T>
+typename flat_tree<Key, T>::iterator flat_tree<Key, T>::begin() {
+  return At(0);
+}
+
+template <typename Key, typename T>
+typename flat_tree<Key, T>::iterator flat_tree<Key, T>::end() {
+  return nullptr;
+}
+
+template <typename Key, typename T>
+typename flat_tree<Key, T>::const_iterator flat_tree<Key, T>::begin() const {
+  return At(0);
+}
+
+template <typename Key, typename T>
+typename flat_tree<Key, T>::const_iterator flat_tree<Key, T>::end() const {
+  return nullptr;
+}
+
+template <typename Key, typename T>
+typename flat_tree<Key, T>::const_iterator flat_tree<Key, T>::cbegin() const {
+  return begin();
+}
+
+template <typename Key, typename T>
+typename flat_tree<Key, T>::const_iterator flat_tree<Key, T>::cend() const {
+  return end();
+}
+
+////////////////////// CAPACITY
+
+template <typename Key, typename T>
+bool flat_tree<Key, T>::empty() const {
+  return values_.size() == 0;
+}
+
+template <typename Key, typename T>
+typename flat_tree<Key, T>::size_type flat_tree<Key, T>::size() const {
+  return values_.size();
+}
+
+template <typename Key, typename T>
+typename flat_tree<Key, T>::size_type flat_tree<Key, T>::max_size() const {
+  return values_.max_size();
+}
+
+////////////////////// MODIFIERS
+
+template <typename Key, typename T>
+void flat_tree<Key, T>::clear() {
+  values_.clear();
+}
+
+// Equal keys keep insertion order, as in tree.
+template <typename Key, typename T>
+std::pair<typename flat_tree<Key, T>::iterator, bool> flat_tree<Key, T>::insert(
+    const value_type& value) {
+  size_type i = UpperBound(KeyOf(value));
+  InsertAt(i, value);
+  return {At(i), true};
+}
+
+template <typename Key, typename T>
+std::pair<typename flat_tree<Key, T>::iterator, bool>
+flat_tree<Key, T>::insert_unique(const value_type& value) {
+  return emplace_key(KeyOf(value), value);
+}
+
+// Constructs value_type(args...) at key's position unless key is present.
+template <typename Key, typename T>
+template <typename K, typename... Args>
+std::pair<typename flat_tree<Key, T>::iterator, bool>
+flat_tree<Key, T>::emplace_key(const K& key, Args&&... args) {
+  size_type i = LowerBound(key);
+  if (i < size() && !(key < KeyOf(Data()[i]))) return {At(i), false};
+  InsertAt(i, std::forward<Args>(args)...);
+  return {At(i), true};
+}
+
+// New values are appended, sorted on their own (skipped when the input is
+// already sorted) and merged with the existing ones in a single pass, so a
+// batch of m values costs O(n + m log m) instead of m shifts of the array.
+// With unique set, keys that are already present, or repeated in the
+// input, are dropped.
+template <typename Key, typename T>
+template <typename InputIt, typename>
+void flat_tree<Key, T>::insert(InputIt first, InputIt last, bool unique) {
+  size_type old_size = size();
+  for (; first != last; ++first) values_.emplace_back(*first);
+  value_type* data = Data();
+  value_type* mid = data + old_size;
+  value_type* end = data + size();
+  if (!std::is_sorted(mid, end, Less)) std::stable_sort(mid, end, Less);
+  std::inplace_merge(data, mid, end, Less);
+  if (unique) {
+    auto same = [](const value_type& a, const value_type& b) {
+      return !Less(a, b);
+    };
+    Truncate(std::unique(data, end, same) - data);
+  }
+}
+
+template <typename Key, typename T>
+void flat_tree<Key, T>::erase(iterator pos) {
+  if (pos.ptr_ == nullptr) return;
+  values_.erase(typename s21::vector<value_type>::iterator(pos.ptr_));
+}
+
+// One shift of the tail, whatever the length of the range.
+template <typename Key, typename T>
+typename flat_tree<Key, T>::iterator flat_tree<Key, T>::erase(iterator first,
+                                                              iterator last) {
+  if (first.ptr_ == nullptr) return nullptr;
+  using VectorIterator = typename s21::vector<value_type>::iterator;
+  value_type* stop = last.ptr_ ? last.ptr_ : Data() + size();
+  size_type i = first.ptr_ - Data();
+  values_.erase(VectorIterator(first.ptr_), VectorIterator(stop));
+  return At(i);
+}
+
+template <typename Key, typename T>
+void flat_tree<Key, T>::swap(flat_tree& other) {
+  values_.swap(other.values_);
+}
+
+// Both arrays are rebuilt in one ordered pass; with unique set, the values
+// whose key is already present stay in other.
+template <typename Key, typename T>
+void flat_tree<Key, T>::merge(flat_tree& other, bool unique) {
+  if (this == &other || other.empty()) return;
+  s21::vector<value_type> res, left;
+  res.reserve(size() + other.size());
+  value_type *a = Data(), *a_end = a + size();
+  value_type *b = other.Data(), *b_end = b + other.size();
+  while (a != a_end || b != b_end) {
+    if (b == b_end || (a != a_end && !Less(*b, *a))) {
+      if (unique && b != b_end && !Less(*a, *b)) {
+        left.push_back(std::move(*b++));
+      }
+      res.push_back(std::move(*a++));
+    } else {
+      res.push_back(std::move(*b++));
+    }
+  }
+  values_.swap(res);
+  other.values_.swap(left);
+}
+
+template <typename Key, typename T>
+flat_tree<Key, T> flat_tree<Key, T>::Combine(const flat_tree& a,
+                                             const flat_tree& b,
+                                             SetOperation op) {
+  return CombineValues<const flat_tree>(a, b, op);
+}
+
+// Moves the values instead of copying them; a and b are left empty.
+template <typename Key, typename T>
+flat_tree<Key, T> flat_tree<Key, T>::Combine(flat_tree&& a, flat_tree&& b,
+                                             SetOperation op) {
+  flat_tree res = CombineValues<flat_tree>(a, b, op);
+  a.clear();
+  b.clear();
+  return res;
+}
+
+////////////////////// LOOKUP
+
+template <typename Key, typename T>
+typename flat_tree<Key, T>::const_iterator flat_tree<Key, T>::find(
+    const value_type& value) const {
+  return find_key(KeyOf(value));
+}
+
+template <typename Key, typename T>
+template <typename K>
+typename flat_tree<Key, T>::iterator flat_tree<Key, T>::find_key(
+    const K& key) const {
+  size_type i = LowerBound(key);
+  if (i == size() || key < KeyOf(Data()[i])) return nullptr;
+  return At(i);
+}
+
+template <typename Key, typename T>
+bool flat_tree<Key, T>::contains(const Key& key) const {
+  return find_key(key) != nullptr;
+}
+
+template <typename Key, typename T>
+template <typename K>
+typename flat_tree<Key, T>::iterator flat_tree<Key, T>::lower_bound(
+    const K& key) const {
+  return At(LowerBound(key));
+}
+
+template <typename Key, typename T>
+template <typename K>
+typename flat_tree<Key, T>::iterator flat_tree<Key, T>::upper_bound(
+    const K& key) const {
+  return At(UpperBound(key));
+}
+
+template <typename Key, typename T>
+template <typename K>
+typename flat_tree<Key, T>::size_type flat_tree<Key, T>::count(
+    const K& key) const {
+  return UpperBound(key) - LowerBound(key);
+}
+
+template <typename Key, typename T>
+typename flat_tree<Key, T>::iterator flat_tree<Key, T>::nth(
+    size_type k) const {
+  if (k >= size()) throw std::out_of_range("Index out of range");
+  return At(k);
+}
+
+template <typename Key, typename T>
+template <typename K>
+typename flat_tree<Key, T>::size_type flat_tree<Key, T>::rank(
+    const K& key) const {
+  return LowerBound(key);
+}
+
+// Later inserts shift the array, so only the last returned iterator is
+// guaranteed to stay valid.
+template <typename Key, typename T>
+template <typename... Args>
+s21::vector<std::pair<typename flat_tree<Key, T>::iterator, bool>>
+flat_tree<Key, T>::insert_many(Args&&... args) {
+  s21::vector<std::pair<iterator, bool>> my_vector;
+  for (auto i : {std::forward<Args>(args)...}) my_vector.push_back(insert(i));
+  return my_vector;
+}
+
+template <typename Key, typename T>
+const Key& flat_tree<Key, T>::KeyOf(const value_type& value) {
+  if constexpr (std::is_same<Key, value_type>::value) {
+    return value;
+  } else {
+    return value.first;
+  }
+}
+
+////////////////////// PRIVATE FUNCTIONS
+
+template <typename Key, typename T>
+typename flat_tree<Key, T>::iterator flat_tree<Key, T>::At(size_type i) const {
+  return iterator(Data() + i, Data(), Data() + size());
+}
+
+// Halves the range without branching on the comparison: the step is a
+// conditional move, so the loop runs ceil(log2(n)) times whatever the
+// keys are and never mispredicts.
+template <typename Key, typename T>
+template <typename K>
+typename flat_tree<Key, T>::size_type flat_tree<Key, T>::LowerBound(
+    const K& key) const {
+  const value_type* base = Data();
+  size_type len = size();
+  if (len == 0) return 0;
+  while (len > 1) {
+    size_type half = len / 2;
+    base = KeyOf(base[half]) < key ? base + half : base;
+    len -= half;
+  }
+  return base - Data() + (KeyOf(*base) < key);
+}
+
+template <typename Key, typename T>
+template <typename K>
+typename flat_tree<Key, T>::size_type flat_tree<Key, T>::UpperBound(
+    const K& key) const {
+  const value_type* base = Data();
+  size_type len = size();
+  if (len == 0) return 0;
+  while (len > 1) {
+    size_type half = len / 2;
+    base = key < KeyOf(base[half]) ? base : base + half;
+    len -= half;
+  }
+  return base - Data() + !(key < KeyOf(*base));
+}
+
+// Appends go through emplace_back, which also covers the empty array.
+template <typename Key, typename T>
+template <typename... Args>
+void flat_tree<Key, T>::InsertAt(size_type i, Args&&... args) {
+  if (i == size()) {
+    values_.emplace_back(std::forward<Args>(args)...);
+  } else {
+    values_.emplace(typename s21::vector<value_type>::iterator(Data() + i),
+                    std::forward<Args>(args)...);
+  }
+}
+
+template <typename Key, typename T>
+template <typename Tree>
+flat_tree<Key, T> flat_tree<Key, T>::CombineValues(Tree& a, Tree& b,
+                                                   SetOperation op) {
+  // Copies from const trees, moves otherwise.
+  using Ref = std::conditional_t<std::is_const<Tree>::value,
+                                 const value_type&, value_type&&>;
+  bool keep_a = op != SetOperation::kIntersection;
+  bool keep_b = op == SetOperation::kUnion;
+  bool keep_common = op != SetOperation::kDifference;
+  flat_tree res;
+  auto ia = a.Data(), a_end = ia + a.size();
+  auto ib = b.Data(), b_end = ib + b.size();
+  while (ia != a_end && ib != b_end) {
+    if (Less(*ia, *ib)) {
+      if (keep_a) res.values_.push_back(static_cast<Ref>(*ia));
+      ++ia;
+    } else if (Less(*ib, *ia)) {
+      if (keep_b) res.values_.push_back(static_cast<Ref>(*ib));
+      ++ib;
+    } else {
+      if (keep_common) res.values_.push_back(static_cast<Ref>(*ia));
+      ++ia;
+      ++ib;
+    }
+  }
+  for (; keep_a && ia != a_end; ++ia) {
+    res.values_.push_back(static_cast<Ref>(*ia));
+  }
+  for (; keep_b && ib != b_end; ++ib) {
+    res.values_.push_back(static_cast<Ref>(*ib));
+  }
+  return res;
+}
+
+template <typename Key, typename T>
+void flat_tree<Key, T>::Truncate(size_type n) {
+  while (size() > n) values_.pop_back();
+}
+
+}  // namespace s21
@@ -0,0 +1,20 @@
+#ifndef CPP2_S21_CONTAINERS_S21_FLAT_MAP_H_
+#define CPP2_S21_CONTAINERS_S21_FLAT_MAP_H_
+
+#include <functional>
+#include <utility>
+
+#include "../flat/s21_flat_tree.h"
+#include "../map/s21_map.h"
+
+namespace s21 {
+
+// Map kept in one sorted array. The pairs are stored as std::pair<Key, T>
+// because the array assigns over its elements when it shifts them; the key
+// must still not be changed through an iterator.
+template <typename Key, typename T, typename Compare = std::less<Key>>
+using flat_map = Map<Key, T, flat_tree<Key, std::pair<Key, T>>, Compare>;
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_FLAT_MAP_H_
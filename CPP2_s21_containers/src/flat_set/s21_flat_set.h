@@ -0,0 +1,20 @@
+#ifndef CPP2_S21_CONTAINERS_S21_FLAT_SET_H_
+#define CPP2_S21_CONTAINERS_S21_FLAT_SET_H_
+
+#include "../flat/s21_flat_tree.h"
+#include "../multiset/s21_multiset.h"
+#include "../set/s21_set.h"
+
+namespace s21 {
+
+// Set and Multiset kept in one sorted array. Build them from a range, or
+// fill them with insert(first, last), which merges a whole batch at once.
+template <typename Key>
+using flat_set = Set<Key, flat_tree<Key, Key>>;
+
+template <typename Key>
+using flat_multiset = Multiset<Key, flat_tree<Key, Key>>;
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_FLAT_SET_H_
@@ -0,0 +1,545 @@
+#ifndef CPP2_S21_CONTAINERS_S21_HASH_TABLE_H_
+#define CPP2_S21_CONTAINERS_S21_HASH_TABLE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+namespace hash_detail {
+
+// One control byte per slot: kEmpty, kDeleted, or the low 7 bits of the
+// hash of a full slot. kSentinel marks the end for iteration.
+using ctrl_t = signed char;
+constexpr ctrl_t kEmpty = -128;
+constexpr ctrl_t kDeleted = -2;
+constexpr ctrl_t kSentinel = -1;
+constexpr size_t kGroupWidth = 16;
+
+inline bool IsFull(ctrl_t ctrl) { return ctrl >= 0; }
+
+// Sixteen control bytes compared at once. Each Match* returns a mask with
+// bit i set when byte i matches.
+class Group {
+ public:
+#if defined(__SSE2__)
+  explicit Group(const ctrl_t *pos)
+      : ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i *>(pos))) {}
+
+  uint32_t Match(ctrl_t h2) const {
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_));
+  }
+
+  uint32_t MatchEmpty() const { return Match(kEmpty); }
+
+  // Empty or deleted: the only values below kSentinel.
+  uint32_t MatchFree() const {
+    return _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(kSentinel), ctrl_));
+  }
+
+ private:
+  __m128i ctrl_;
+#else
+  explicit Group(const ctrl_t *pos) { std::memcpy(ctrl_, pos, kGroupWidth); }
+
+  uint32_t Match(ctrl_t h2) const {
+    uint32_t mask = 0;
+    for (size_t i = 0; i < kGroupWidth; i++) {
+      if (ctrl_[i] == h2) mask |= 1u << i;
+    }
+    return mask;
+  }
+
+  uint32_t MatchEmpty() const { return Match(kEmpty); }
+
+  uint32_t MatchFree() const {
+    uint32_t mask = 0;
+    for (size_t i = 0; i < kGroupWidth; i++) {
+      if (ctrl_[i] < kSentinel) mask |= 1u << i;
+    }
+    return mask;
+  }
+
+ private:
+  ctrl_t ctrl_[kGroupWidth];
+#endif
+};
+
+inline size_t LowestBit(uint32_t mask) { return __builtin_ctz(mask); }
+
+// std::hash is the identity for integers; the 64-bit MurmurHash3 finalizer
+// spreads it so that both the probe start and the 7-bit tag are usable.
+inline size_t Mix(size_t hash) {
+  uint64_t h = hash;
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+  return static_cast<size_t>(h);
+}
+
+// Control bytes of a table that has not allocated yet.
+inline ctrl_t *EmptyGroup() {
+  alignas(16) static ctrl_t group[kGroupWidth] = {
+      kSentinel, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty,
+      kEmpty,    kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty, kEmpty};
+  return group;
+}
+
+template <typename T, typename = void>
+struct IsTransparent : std::false_type {};
+
+template <typename T>
+struct IsTransparent<T, std::void_t<typename T::is_transparent>>
+    : std::true_type {};
+
+}  // namespace hash_detail
+
+// Enables the heterogeneous lookup overloads when both the hash and the key
+// comparison declare is_transparent.
+template <typename Hash, typename KeyEqual>
+using RequireTransparent =
+    std::enable_if_t<hash_detail::IsTransparent<Hash>::value &&
+                     hash_detail::IsTransparent<KeyEqual>::value>;
+
+template <typename Value>
+class HashIterator {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = std::remove_const_t<Value>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = Value *;
+  using reference = Value &;
+
+  HashIterator() : ctrl_(nullptr), slot_(nullptr) {}
+  HashIterator(hash_detail::ctrl_t *ctrl, Value *slot)
+      : ctrl_(ctrl), slot_(slot) {
+    SkipFree();
+  }
+  template <typename Other, typename = std::enable_if_t<
+                                std::is_same<const Other, Value>::value>>
+  HashIterator(const HashIterator<Other> &other)
+      : ctrl_(other.ctrl_), slot_(other.slot_) {}
+
+  reference operator*() const { return *slot_; }
+  pointer operator->() const { return slot_; }
+
+  HashIterator &operator++() {
+    ++ctrl_;
+    ++slot_;
+    SkipFree();
+    return *this;
+  }
+
+  HashIterator operator++(int) {
+    HashIterator tmp = *this;
+    ++(*this);
+    return tmp;
+  }
+
+  bool operator==(const HashIterator &other) const {
+    return ctrl_ == other.ctrl_;
+  }
+  bool operator!=(const HashIterator &other) const {
+    return ctrl_ != other.ctrl_;
+  }
+
+ private:
+  template <typename>
+  friend class HashIterator;
+  template <typename, typename, typename, typename>
+  friend class hash_table;
+
+  // Stops at the next full slot or at the sentinel after the last slot.
+  void SkipFree() {
+    while (*ctrl_ < hash_detail::kSentinel) {
+      ++ctrl_;
+      ++slot_;
+    }
+  }
+
+  hash_detail::ctrl_t *ctrl_;
+  Value *slot_;
+};
+
+// Open-addressing table in the style of Abseil's Swiss tables. Capacity is
+// 2^k - 1 slots with a control byte each; the first 15 control bytes are
+// mirrored after the sentinel so a probe can always load a whole group.
+// Probing visits groups in triangular steps and stops at the first group
+// that holds an empty byte. At most 7/8 of the slots are ever used.
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+class hash_table {
+ public:
+  using key_type = Key;
+  using value_type = Value;
+  using size_type = size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using iterator = HashIterator<value_type>;
+  using const_iterator = HashIterator<const value_type>;
+
+  explicit hash_table(size_type count = 0, const Hash &hash = Hash(),
+                      const KeyEqual &equal = KeyEqual())
+      : ctrl_(hash_detail::EmptyGroup()),
+        slots_(nullptr),
+        capacity_(0),
+        size_(0),
+        growth_left_(0),
+        hash_(hash),
+        equal_(equal) {
+    if (count) reserve(count);
+  }
+
+  // Same capacity and layout as other, so no element is rehashed.
+  hash_table(const hash_table &other)
+      : hash_table(0, other.hash_, other.equal_) {
+    if (!other.size_) return;
+    Allocate(other.capacity_);
+    std::memcpy(ctrl_, other.ctrl_, CtrlBytes(capacity_));
+    size_type i = 0;
+    try {
+      for (; i < capacity_; i++) {
+        if (hash_detail::IsFull(ctrl_[i])) {
+          new (slots_ + i) value_type(other.slots_[i]);
+        }
+      }
+    } catch (...) {
+      for (size_type j = 0; j < i; j++) {
+        if (hash_detail::IsFull(ctrl_[j])) slots_[j].~value_type();
+      }
+      Deallocate();
+      throw;
+    }
+    size_ = other.size_;
+    growth_left_ = other.growth_left_;
+  }
+
+  hash_table(hash_table &&other) noexcept
+      : hash_table(0, other.hash_, other.equal_) {
+    swap(other);
+  }
+
+  ~hash_table() {
+    DestroyAll();
+    Deallocate();
+  }
+
+  hash_table &operator=(const hash_table &other) {
+    if (this != &other) {
+      hash_table tmp(other);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  hash_table &operator=(hash_table &&other) noexcept {
+    if (this != &other) {
+      hash_table tmp(std::move(other));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  iterator begin() { return iterator(ctrl_, slots_); }
+  iterator end() { return iterator(ctrl_ + capacity_, slots_ + capacity_); }
+  const_iterator begin() const { return const_iterator(ctrl_, slots_); }
+  const_iterator end() const {
+    return const_iterator(ctrl_ + capacity_, slots_ + capacity_);
+  }
+
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max() /
+           (sizeof(value_type) + sizeof(hash_detail::ctrl_t));
+  }
+  size_type bucket_count() const { return capacity_; }
+  float load_factor() const {
+    return capacity_ ? static_cast<float>(size_) / capacity_ : 0.0f;
+  }
+  hasher hash_function() const { return hash_; }
+  key_equal key_eq() const { return equal_; }
+
+  // Keeps the allocation; only the elements go.
+  void clear() {
+    DestroyAll();
+    if (capacity_) ResetCtrl();
+    size_ = 0;
+    growth_left_ = MaxLoad(capacity_);
+  }
+
+  // Makes room for count elements without further rehashing.
+  void reserve(size_type count) {
+    if (count > size_ + growth_left_) Resize(CapacityFor(count));
+  }
+
+  template <typename K>
+  iterator find(const K &key) {
+    return IteratorAt(FindIndex(key, HashOf(key)));
+  }
+
+  template <typename K>
+  const_iterator find(const K &key) const {
+    size_type i = FindIndex(key, HashOf(key));
+    return const_iterator(ctrl_ + i, slots_ + i);
+  }
+
+  template <typename K>
+  bool contains(const K &key) const {
+    return FindIndex(key, HashOf(key)) != capacity_;
+  }
+
+  // Inserts a value built from args unless key is already present.
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> emplace_key(const K &key, Args &&...args) {
+    size_t hash = HashOf(key);
+    size_type i = FindIndex(key, hash);
+    if (i != capacity_) return {IteratorAt(i), false};
+    i = PrepareInsert(hash);
+    new (slots_ + i) value_type(std::forward<Args>(args)...);
+    Occupy(i, hash);
+    return {IteratorAt(i), true};
+  }
+
+  std::pair<iterator, bool> insert(const value_type &value) {
+    return emplace_key(KeyOf(value), value);
+  }
+
+  std::pair<iterator, bool> insert(value_type &&value) {
+    return emplace_key(KeyOf(value), std::move(value));
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args) {
+    value_type value(std::forward<Args>(args)...);
+    return emplace_key(KeyOf(value), std::move(value));
+  }
+
+  void erase(const_iterator pos) {
+    if (pos == end()) return;
+    EraseAt(static_cast<size_type>(pos.slot_ - slots_));
+  }
+
+  template <typename K>
+  size_type erase_key(const K &key) {
+    size_type i = FindIndex(key, HashOf(key));
+    if (i == capacity_) return 0;
+    EraseAt(i);
+    return 1;
+  }
+
+  void swap(hash_table &other) noexcept {
+    std::swap(ctrl_, other.ctrl_);
+    std::swap(slots_, other.slots_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(size_, other.size_);
+    std::swap(growth_left_, other.growth_left_);
+    std::swap(hash_, other.hash_);
+    std::swap(equal_, other.equal_);
+  }
+
+  // Moves the elements whose key is not yet present out of other.
+  void merge(hash_table &other) {
+    if (this == &other) return;
+    for (size_type i = 0; i < other.capacity_; i++) {
+      if (!hash_detail::IsFull(other.ctrl_[i])) continue;
+      if (emplace_key(KeyOf(other.slots_[i]), std::move(other.slots_[i]))
+              .second) {
+        other.EraseAt(i);
+      }
+    }
+  }
+
+  static const Key &KeyOf(const value_type &value) {
+    if constexpr (std::is_same<Key, value_type>::value) {
+      return value;
+    } else {
+      return value.first;
+    }
+  }
+
+ private:
+  static size_type CtrlBytes(size_type capacity) {
+    return capacity + hash_detail::kGroupWidth;
+  }
+
+  static size_type MaxLoad(size_type capacity) {
+    return capacity - capacity / 8;
+  }
+
+  static size_type CapacityFor(size_type count) {
+    size_type capacity = hash_detail::kGroupWidth - 1;
+    while (MaxLoad(capacity) < count) capacity = capacity * 2 + 1;
+    return capacity;
+  }
+
+  template <typename K>
+  size_t HashOf(const K &key) const {
+    return hash_detail::Mix(hash_(key));
+  }
+
+  static hash_detail::ctrl_t H2(size_t hash) {
+    return static_cast<hash_detail::ctrl_t>(hash & 0x7f);
+  }
+
+  iterator IteratorAt(size_type i) {
+    return iterator(ctrl_ + i, slots_ + i);
+  }
+
+  // Index of the slot holding key, or capacity_ when there is none.
+  template <typename K>
+  size_type FindIndex(const K &key, size_t hash) const {
+    if (!size_) return capacity_;
+    size_type offset = (hash >> 7) & capacity_;
+    for (size_type step = hash_detail::kGroupWidth;;
+         step += hash_detail::kGroupWidth) {
+      hash_detail::Group group(ctrl_ + offset);
+      for (uint32_t mask = group.Match(H2(hash)); mask; mask &= mask - 1) {
+        size_type i = (offset + hash_detail::LowestBit(mask)) & capacity_;
+        if (equal_(KeyOf(slots_[i]), key)) return i;
+      }
+      if (group.MatchEmpty()) return capacity_;
+      offset = (offset + step) & capacity_;
+    }
+  }
+
+  size_type FindFree(size_t hash) const {
+    size_type offset = (hash >> 7) & capacity_;
+    for (size_type step = hash_detail::kGroupWidth;;
+         step += hash_detail::kGroupWidth) {
+      uint32_t mask = hash_detail::Group(ctrl_ + offset).MatchFree();
+      if (mask) return (offset + hash_detail::LowestBit(mask)) & capacity_;
+      offset = (offset + step) & capacity_;
+    }
+  }
+
+  // Free slot for a new element with this hash, growing the table first
+  // when the slot would use up the load budget.
+  size_type PrepareInsert(size_t hash) {
+    if (!capacity_) Resize(CapacityFor(1));
+    size_type i = FindFree(hash);
+    if (!growth_left_ && ctrl_[i] == hash_detail::kEmpty) {
+      // Mostly tombstones: rehash in place; otherwise double.
+      Resize(size_ * 2 < MaxLoad(capacity_) ? capacity_ : capacity_ * 2 + 1);
+      i = FindFree(hash);
+    }
+    return i;
+  }
+
+  void Occupy(size_type i, size_t hash) {
+    if (ctrl_[i] == hash_detail::kEmpty) growth_left_--;
+    SetCtrl(i, H2(hash));
+    size_++;
+  }
+
+  // A slot can go back to empty when no probe window containing it is
+  // full, because then no probe ever passed over it.
+  void EraseAt(size_type i) {
+    slots_[i].~value_type();
+    size_--;
+    bool never_full = capacity_ < hash_detail::kGroupWidth;
+    if (!never_full) {
+      uint32_t after = hash_detail::Group(ctrl_ + i).MatchEmpty();
+      uint32_t before =
+          hash_detail::Group(ctrl_ + ((i - hash_detail::kGroupWidth) &
+                                      capacity_))
+              .MatchEmpty();
+      never_full = after && before &&
+                   hash_detail::LowestBit(after) +
+                           (__builtin_clz(before) - 16) <
+                       hash_detail::kGroupWidth;
+    }
+    if (never_full) {
+      SetCtrl(i, hash_detail::kEmpty);
+      growth_left_++;
+    } else {
+      SetCtrl(i, hash_detail::kDeleted);
+    }
+  }
+
+  // Writes the control byte and its mirror past the sentinel.
+  void SetCtrl(size_type i, hash_detail::ctrl_t value) {
+    const size_type cloned = hash_detail::kGroupWidth - 1;
+    ctrl_[i] = value;
+    ctrl_[((i - cloned) & capacity_) + cloned] = value;
+  }
+
+  void ResetCtrl() {
+    std::memset(ctrl_, hash_detail::kEmpty, CtrlBytes(capacity_));
+    ctrl_[capacity_] = hash_detail::kSentinel;
+  }
+
+  void Allocate(size_type capacity) {
+    slots_ = static_cast<value_type *>(
+        ::operator new(capacity * sizeof(value_type)));
+    try {
+      ctrl_ = static_cast<hash_detail::ctrl_t *>(
+          ::operator new(CtrlBytes(capacity)));
+    } catch (...) {
+      ::operator delete(slots_);
+      slots_ = nullptr;
+      throw;
+    }
+    capacity_ = capacity;
+    ResetCtrl();
+    growth_left_ = MaxLoad(capacity);
+  }
+
+  void Deallocate() {
+    if (!capacity_) return;
+    ::operator delete(ctrl_);
+    ::operator delete(slots_);
+    ctrl_ = hash_detail::EmptyGroup();
+    slots_ = nullptr;
+    capacity_ = 0;
+    growth_left_ = 0;
+  }
+
+  void DestroyAll() {
+    if constexpr (!std::is_trivially_destructible<value_type>::value) {
+      for (size_type i = 0; i < capacity_; i++) {
+        if (hash_detail::IsFull(ctrl_[i])) slots_[i].~value_type();
+      }
+    }
+  }
+
+  // Moves every element into a fresh table of the given capacity. Elements
+  // are copied when their move may throw, so a failure leaves this intact.
+  void Resize(size_type capacity) {
+    hash_table fresh(0, hash_, equal_);
+    fresh.Allocate(capacity);
+    for (size_type i = 0; i < capacity_; i++) {
+      if (!hash_detail::IsFull(ctrl_[i])) continue;
+      size_t hash = HashOf(KeyOf(slots_[i]));
+      size_type j = fresh.FindFree(hash);
+      new (fresh.slots_ + j) value_type(std::move_if_noexcept(slots_[i]));
+      fresh.Occupy(j, hash);
+    }
+    swap(fresh);
+  }
+
+  hash_detail::ctrl_t *ctrl_;
+  value_type *slots_;
+  size_type capacity_;
+  size_type size_;
+  size_type growth_left_;
+  Hash hash_;
+  KeyEqual equal_;
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_HASH_TABLE_H_
@@ -1,5 +1,9 @@
+#include <functional>
 #include <iostream>
 #include <limits>
+#include <type_traits>
+
+#include "../pool/s21_node_pool.h"
 
 namespace s21 {
 
@@ -183,8 +187,7 @@ class list {
   }
 
   void push_back(const_reference value) {
-    node<value_type> *new_node = new (std::nothrow) node<value_type>(value);
-    if (!new_node) throw "no memory";
+    node<value_type> *new_node = pool_.create(value);
     if (!head_ && !tail_) {
       head_ = tail_ = new_node;
     } else {
@@ -206,13 +209,12 @@ class list {
       tail_->next_ = end_;
       end_->prev_ = tail_;
     }
-    delete tmp;
+    pool_.destroy(tmp);
     end_->data_ = --count_;
   }
 
   void push_front(const_reference value) {
-    node<value_type> *new_node = new (std::nothrow) node<value_type>(value);
-    if (!new_node) throw "no memory";
+    node<value_type> *new_node = pool_.create(value);
     if (!head_ && !tail_) {
       head_ = tail_ = new_node;
     } else {
@@ -229,7 +231,7 @@ class list {
     head_ = head_->next_;
     head_->prev_ = end_;
     end_->next_ = head_;
-    delete tmp;
+    pool_.destroy(tmp);
     end_->data_ = --count_;
   }
 
@@ -238,38 +240,44 @@ class list {
     std::swap(tail_, other.tail_);
     std::swap(end_, other.end_);
     std::swap(count_, other.count_);
+    pool_.swap(other.pool_);
   }
 
-  void merge(list &other) {
-    if (this != &other) {
-      auto it_t = begin();
-      auto it_o = other.begin();
-
-      while (it_t != end() && it_o != other.end()) {
-        if (*it_o < *it_t) {
-          insert(it_t, *it_o);
-          ++it_o;
-        } else {
-          ++it_t;
-        }
-      }
+  void merge(list &other) { merge(other, std::less<value_type>()); }
 
-      while (it_o != other.end()) {
-        push_back(*it_o);
-        ++it_o;
+  // Relinks the nodes of other into this list in O(n + m) without
+  // allocating or copying. Equal elements of this list stay first.
+  template <class Compare>
+  void merge(list &other, Compare comp) {
+    if (this == &other || !other.count_) return;
+    if (!count_) {
+      splice(cend(), other);
+      return;
+    }
+    other.tail_->next_ = nullptr;
+    node<value_type> *incoming = other.head_;
+    node<value_type> *cur = head_;
+    while (incoming && cur != end_) {
+      if (comp(incoming->data_, cur->data_)) {
+        node<value_type> *next = incoming->next_;
+        link_before(cur, incoming, incoming);
+        incoming = next;
+      } else {
+        cur = cur->next_;
       }
-
-      other.clear();
     }
+    if (incoming) link_before(end_, incoming, other.tail_);
+    take_nodes(other);
   }
 
+  // Moves all nodes of other before pos in O(1).
   void splice(const_iterator pos, list &other) {
-    auto it = other.begin();
-    iterator it_pos(pos.get_ptr());
-    for (size_type i = 0; i < other.size(); i++, ++it) {
-      insert(it_pos, *it);
+    if (this == &other || !other.count_) return;
+    if (!count_) {
+      end_->next_ = end_->prev_ = end_;
     }
-    other.clear();
+    link_before(pos.get_ptr(), other.head_, other.tail_);
+    take_nodes(other);
   }
 
   void reverse() {
@@ -294,24 +302,67 @@ class list {
     }
   }
 
-  void sort() {
-    for (int i = 1; i < count_; i++) {
-      auto it = begin();
-      auto it_n = ++begin();
-      for (int j = 1; j < count_; j++, ++it, ++it_n) {
-        if (*it > *it_n) {
-          std::swap(it.ptr_->data_, it_n.ptr_->data_);
+  void sort() { sort(std::less<value_type>()); }
+
+  // Stable bottom-up merge sort. Nodes are relinked and payloads never
+  // move, so it is O(n log n) with no element copies.
+  template <class Compare>
+  void sort(Compare comp) {
+    if (count_ < 2) return;
+    tail_->next_ = nullptr;
+    node<value_type> *chain = head_;
+    for (size_type width = 1;; width *= 2) {
+      node<value_type> *result = nullptr;
+      node<value_type> **result_tail = &result;
+      node<value_type> *left = chain;
+      size_type merges = 0;
+      while (left) {
+        merges++;
+        node<value_type> *right = left;
+        size_type left_size = 0;
+        while (left_size < width && right) {
+          right = right->next_;
+          left_size++;
         }
+        size_type right_size = width;
+        while (left_size || (right_size && right)) {
+          node<value_type> *next;
+          if (!left_size || (right_size && right &&
+                             comp(right->data_, left->data_))) {
+            next = right;
+            right = right->next_;
+            right_size--;
+          } else {
+            next = left;
+            left = left->next_;
+            left_size--;
+          }
+          *result_tail = next;
+          result_tail = &next->next_;
+        }
+        left = right;
       }
+      *result_tail = nullptr;
+      chain = result;
+      if (merges <= 1) break;
     }
+    relink(chain);
   }
 
+  // Destroys the values in place and frees all slabs at once, instead of
+  // unlinking the nodes one by one.
   void clear() {
-    if (count_ != 0) {
-      while (count_) {
-        pop_back();
+    if constexpr (!std::is_trivially_destructible<node<value_type>>::value) {
+      for (node<value_type> *cur = head_; cur && cur != end_;) {
+        node<value_type> *next = cur->next_;
+        cur->~node<value_type>();
+        cur = next;
       }
     }
+    pool_.release();
+    zeroing();
+    end_->next_ = end_->prev_ = end_;
+    end_->data_ = count_;
   }
 
   iterator insert(iterator pos, const_reference value) {
@@ -320,11 +371,9 @@ class list {
     } else if (pos == end_) {
       push_back(value);
     } else {
-      node<value_type> *new_obj = new (std::nothrow) node<value_type>;
-      if (!new_obj) throw "no memory";
+      node<value_type> *new_obj = pool_.create(value);
       node<value_type> *temp = pos.ptr_->prev_;
       end_->data_ = ++count_;
-      new_obj->data_ = value;
       temp->next_ = new_obj;
       new_obj->prev_ = temp;
       new_obj->next_ = pos.ptr_;
@@ -341,7 +390,7 @@ class list {
     } else {
       pos.ptr_->next_->prev_ = pos.ptr_->prev_;
       pos.ptr_->prev_->next_ = pos.ptr_->next_;
-      delete pos.ptr_;
+      pool_.destroy(pos.ptr_);
       end_->data_ = --count_;
     }
   }
@@ -390,6 +439,44 @@ class list {
     }
   }
 
+  // Links the chain first..last in front of pos; head_ and tail_ follow
+  // the end_ ring.
+  void link_before(node<value_type> *pos, node<value_type> *first,
+                   node<value_type> *last) {
+    node<value_type> *before = pos->prev_;
+    before->next_ = first;
+    first->prev_ = before;
+    last->next_ = pos;
+    pos->prev_ = last;
+    head_ = end_->next_;
+    tail_ = end_->prev_;
+  }
+
+  // Finishes a splice or merge: this list owns other's nodes and pool.
+  void take_nodes(list &other) {
+    count_ += other.count_;
+    end_->data_ = count_;
+    pool_.adopt(other.pool_);
+    other.zeroing();
+    other.end_->next_ = other.end_->prev_ = other.end_;
+    other.end_->data_ = other.count_;
+  }
+
+  // Rebuilds prev_ links and the end_ ring for a nullptr-terminated chain
+  // holding all count_ nodes.
+  void relink(node<value_type> *chain) {
+    head_ = chain;
+    node<value_type> *prev = end_;
+    for (node<value_type> *cur = chain; cur; cur = cur->next_) {
+      cur->prev_ = prev;
+      prev = cur;
+    }
+    tail_ = prev;
+    tail_->next_ = end_;
+    end_->next_ = head_;
+    end_->prev_ = tail_;
+  }
+
   void connect() {
     end_->next_ = head_;
     end_->prev_ = tail_;
@@ -403,5 +490,6 @@ class list {
   node<value_type> *tail_;
   node<value_type> *end_;
   int count_;
+  NodePool<node<value_type>> pool_;
 };
 }  // namespace s21
\ No newline at end of file
@@ -0,0 +1,399 @@
+#ifndef CPP2_S21_CONTAINERS_S21_LOCKFREE_QUEUE_H_
+#define CPP2_S21_CONTAINERS_S21_LOCKFREE_QUEUE_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// Head and tail live on separate cache lines so producers and consumers do
+// not invalidate each other's line on every operation.
+constexpr size_t kCacheLine = 64;
+
+// Smallest power of two, at least 2, that holds n elements.
+inline size_t LockFreeCapacity(size_t n, size_t max) {
+  size_t cap = 2;
+  while (cap < n && cap <= max) cap *= 2;
+  if (cap > max) throw std::length_error("lock-free queue is too large");
+  return cap;
+}
+
+// Bounded lock-free queue for any number of producers and consumers. Each
+// slot carries a sequence number telling which lap of the ring may use it
+// next, so a thread claims a slot with one CAS on head or tail and then
+// hands it over with a release store, without locks. The push_many and
+// pop_many batches claim several neighbouring slots with a single CAS.
+//
+// T must be nothrow move constructible: a claimed slot has to be filled.
+// Values that may throw while being built are built before the claim.
+template <class T>
+class mpmc_queue {
+  static_assert(std::is_nothrow_move_constructible<T>::value,
+                "mpmc_queue needs a nothrow move constructor");
+  static_assert(std::is_nothrow_destructible<T>::value,
+                "mpmc_queue needs a nothrow destructor");
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  explicit mpmc_queue(size_type capacity)
+      : head_(0), tail_(0), cells_(nullptr), mask_(0) {
+    size_type cap = LockFreeCapacity(capacity, max_size());
+    cells_ = new Cell[cap];
+    mask_ = cap - 1;
+    for (size_type i = 0; i < cap; i++) {
+      cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  mpmc_queue(const mpmc_queue &) = delete;
+  mpmc_queue &operator=(const mpmc_queue &) = delete;
+
+  ~mpmc_queue() {
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    for (size_type i = head_.load(std::memory_order_relaxed); i != tail;
+         i++) {
+      At(i).value()->~T();
+    }
+    delete[] cells_;
+  }
+
+  // size() and empty() are snapshots and may be stale once they return.
+  bool empty() const { return size() == 0; }
+  size_type size() const {
+    size_type head = head_.load(std::memory_order_acquire);
+    size_type tail = tail_.load(std::memory_order_acquire);
+    return std::min(tail - head, capacity());
+  }
+  size_type capacity() const { return mask_ + 1; }
+  size_type max_size() const {
+    return (std::numeric_limits<size_type>::max() / 2) / sizeof(Cell);
+  }
+
+  bool try_push(const_reference value) { return try_emplace(value); }
+  bool try_push(T &&value) { return try_emplace(std::move(value)); }
+
+  template <class... Args>
+  bool try_emplace(Args &&...args) {
+    if constexpr (std::is_nothrow_constructible<T, Args &&...>::value) {
+      size_type pos;
+      if (ClaimPush(1, pos) == 0) return false;
+      Publish(pos, std::forward<Args>(args)...);
+      return true;
+    } else {
+      return try_emplace(T(std::forward<Args>(args)...));
+    }
+  }
+
+  bool try_pop(reference out) {
+    size_type pos;
+    if (ClaimPop(1, pos) == 0) return false;
+    T value(Consume(pos));
+    out = std::move(value);
+    return true;
+  }
+
+  // Blocking versions: spin, yielding the thread, until there is room or
+  // an element.
+  void push(const_reference value) {
+    while (!try_push(value)) std::this_thread::yield();
+  }
+  void push(T &&value) {
+    while (!try_push(std::move(value))) std::this_thread::yield();
+  }
+  void pop(reference out) {
+    while (!try_pop(out)) std::this_thread::yield();
+  }
+
+  // Pushes each argument in turn, blocking while the queue is full.
+  template <class... Args>
+  void emplace_back(Args &&...args) {
+    (push(std::forward<Args>(args)), ...);
+  }
+
+  // Pushes from [first, last) until the queue is full and returns how many
+  // elements went in.
+  template <class InputIt>
+  size_type push_many(InputIt first, InputIt last) {
+    using Category = typename std::iterator_traits<InputIt>::iterator_category;
+    size_type count = 0;
+    if constexpr (std::is_base_of<std::forward_iterator_tag,
+                                  Category>::value &&
+                  std::is_nothrow_constructible<
+                      T, decltype(*first)>::value) {
+      size_type left = std::distance(first, last);
+      while (left > 0) {
+        size_type pos;
+        size_type n = ClaimPush(left, pos);
+        if (n == 0) break;
+        for (size_type i = 0; i < n; i++, ++first) Publish(pos + i, *first);
+        count += n;
+        left -= n;
+      }
+    } else {
+      for (; first != last && try_push(*first); ++first) count++;
+    }
+    return count;
+  }
+
+  // Pops up to max elements into out and returns how many were popped. If
+  // writing to out throws, the rest of the claimed batch is dropped.
+  template <class OutputIt>
+  size_type pop_many(OutputIt out, size_type max) {
+    size_type pos;
+    size_type n = ClaimPop(max, pos);
+    size_type i = 0;
+    try {
+      for (; i < n; i++) {
+        T value(Consume(pos + i));
+        *out = std::move(value);
+        ++out;
+      }
+    } catch (...) {
+      for (i++; i < n; i++) Consume(pos + i);
+      throw;
+    }
+    return n;
+  }
+
+ private:
+  struct Cell {
+    std::atomic<size_type> sequence;
+    alignas(T) unsigned char storage[sizeof(T)];
+
+    T *value() { return reinterpret_cast<T *>(storage); }
+  };
+
+  Cell &At(size_type pos) const { return cells_[pos & mask_]; }
+
+  static std::ptrdiff_t Diff(size_type a, size_type b) {
+    return static_cast<std::ptrdiff_t>(a - b);
+  }
+
+  // Claims up to max free slots starting at the tail; returns how many,
+  // 0 when the queue is full. A slot at ticket pos is free when its
+  // sequence equals pos.
+  size_type ClaimPush(size_type max, size_type &pos) {
+    if (max == 0) return 0;
+    pos = tail_.load(std::memory_order_relaxed);
+    for (;;) {
+      size_type n = 0;
+      for (; n < max; n++) {
+        size_type seq = At(pos + n).sequence.load(std::memory_order_acquire);
+        if (seq != pos + n) {
+          if (n == 0 && Diff(seq, pos) < 0) return 0;
+          break;
+        }
+      }
+      if (n == 0) {
+        pos = tail_.load(std::memory_order_relaxed);
+      } else if (tail_.compare_exchange_weak(pos, pos + n,
+                                             std::memory_order_relaxed)) {
+        return n;
+      }
+    }
+  }
+
+  // Claims up to max filled slots starting at the head; 0 when empty. A
+  // slot at ticket pos is filled when its sequence equals pos + 1.
+  size_type ClaimPop(size_type max, size_type &pos) {
+    if (max == 0) return 0;
+    pos = head_.load(std::memory_order_relaxed);
+    for (;;) {
+      size_type n = 0;
+      for (; n < max; n++) {
+        size_type seq = At(pos + n).sequence.load(std::memory_order_acquire);
+        if (seq != pos + n + 1) {
+          if (n == 0 && Diff(seq, pos + 1) < 0) return 0;
+          break;
+        }
+      }
+      if (n == 0) {
+        pos = head_.load(std::memory_order_relaxed);
+      } else if (head_.compare_exchange_weak(pos, pos + n,
+                                             std::memory_order_relaxed)) {
+        return n;
+      }
+    }
+  }
+
+  template <class... Args>
+  void Publish(size_type pos, Args &&...args) {
+    Cell &cell = At(pos);
+    new (cell.value()) T(std::forward<Args>(args)...);
+    cell.sequence.store(pos + 1, std::memory_order_release);
+  }
+
+  // Moves the value out of a claimed slot and frees the slot for the next
+  // lap.
+  T Consume(size_type pos) {
+    Cell &cell = At(pos);
+    T value(std::move(*cell.value()));
+    cell.value()->~T();
+    cell.sequence.store(pos + mask_ + 1, std::memory_order_release);
+    return value;
+  }
+
+  alignas(kCacheLine) std::atomic<size_type> head_;
+  alignas(kCacheLine) std::atomic<size_type> tail_;
+  alignas(kCacheLine) Cell *cells_;
+  size_type mask_;
+};
+
+// Bounded wait-free queue for exactly one producer and one consumer
+// thread. Each side keeps a cached copy of the other side's index on its
+// own cache line and only reloads it when the cached one says full or
+// empty. Batches publish with a single release store.
+template <class T>
+class spsc_queue {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  explicit spsc_queue(size_type capacity)
+      : head_(0), tail_cache_(0), tail_(0), head_cache_(0), mask_(0) {
+    size_type cap = LockFreeCapacity(capacity, max_size());
+    data_ = std::allocator<T>().allocate(cap);
+    mask_ = cap - 1;
+  }
+
+  spsc_queue(const spsc_queue &) = delete;
+  spsc_queue &operator=(const spsc_queue &) = delete;
+
+  ~spsc_queue() {
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    for (size_type i = head_.load(std::memory_order_relaxed); i != tail;
+         i++) {
+      At(i)->~T();
+    }
+    std::allocator<T>().deallocate(data_, capacity());
+  }
+
+  bool empty() const { return size() == 0; }
+  size_type size() const {
+    size_type head = head_.load(std::memory_order_acquire);
+    return tail_.load(std::memory_order_acquire) - head;
+  }
+  size_type capacity() const { return mask_ + 1; }
+  size_type max_size() const {
+    return (std::numeric_limits<size_type>::max() / 2) / sizeof(T);
+  }
+
+  // Producer side.
+  bool try_push(const_reference value) { return try_emplace(value); }
+  bool try_push(T &&value) { return try_emplace(std::move(value)); }
+
+  template <class... Args>
+  bool try_emplace(Args &&...args) {
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    if (!HasRoom(tail)) return false;
+    new (At(tail)) T(std::forward<Args>(args)...);
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  void push(const_reference value) {
+    while (!try_push(value)) std::this_thread::yield();
+  }
+  void push(T &&value) {
+    while (!try_push(std::move(value))) std::this_thread::yield();
+  }
+
+  template <class... Args>
+  void emplace_back(Args &&...args) {
+    (push(std::forward<Args>(args)), ...);
+  }
+
+  // Pushes from [first, last) until the queue is full and returns how many
+  // elements went in. Elements built before an exception stay published.
+  template <class InputIt>
+  size_type push_many(InputIt first, InputIt last) {
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    size_type count = 0;
+    try {
+      for (; first != last && HasRoom(tail + count); ++first, count++) {
+        new (At(tail + count)) T(*first);
+      }
+    } catch (...) {
+      tail_.store(tail + count, std::memory_order_release);
+      throw;
+    }
+    tail_.store(tail + count, std::memory_order_release);
+    return count;
+  }
+
+  // Consumer side.
+  bool try_pop(reference out) {
+    size_type head = head_.load(std::memory_order_relaxed);
+    if (!HasElement(head)) return false;
+    out = std::move(*At(head));
+    At(head)->~T();
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  void pop(reference out) {
+    while (!try_pop(out)) std::this_thread::yield();
+  }
+
+  // Pops up to max elements into out and returns how many were popped. On
+  // an exception from out the element being written stays in the queue.
+  template <class OutputIt>
+  size_type pop_many(OutputIt out, size_type max) {
+    size_type head = head_.load(std::memory_order_relaxed);
+    size_type count = 0;
+    try {
+      for (; count < max && HasElement(head + count); count++) {
+        *out = std::move(*At(head + count));
+        ++out;
+        At(head + count)->~T();
+      }
+    } catch (...) {
+      head_.store(head + count, std::memory_order_release);
+      throw;
+    }
+    head_.store(head + count, std::memory_order_release);
+    return count;
+  }
+
+ private:
+  T *At(size_type pos) const { return data_ + (pos & mask_); }
+
+  bool HasRoom(size_type tail) {
+    if (tail - head_cache_ <= mask_) return true;
+    head_cache_ = head_.load(std::memory_order_acquire);
+    return tail - head_cache_ <= mask_;
+  }
+
+  bool HasElement(size_type head) {
+    if (head != tail_cache_) return true;
+    tail_cache_ = tail_.load(std::memory_order_acquire);
+    return head != tail_cache_;
+  }
+
+  // Consumer line, then producer line.
+  alignas(kCacheLine) std::atomic<size_type> head_;
+  size_type tail_cache_;
+  alignas(kCacheLine) std::atomic<size_type> tail_;
+  size_type head_cache_;
+  alignas(kCacheLine) T *data_;
+  size_type mask_;
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_LOCKFREE_QUEUE_H_
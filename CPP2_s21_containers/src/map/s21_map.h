@@ -1,32 +1,50 @@
 #ifndef CPP2_S21_CONTAINERS_S21_Map_H_
 #define CPP2_S21_CONTAINERS_S21_Map_H_
 
+#include <functional>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
 #include "../tree/s21_tree.h"
 #include "../vector/s21_vector.h"
 
 namespace s21 {
 
-template <typename Key, typename T>
+// Keys are always ordered by operator<. Compare only selects heterogeneous
+// lookup: std::less<> enables it, the default std::less<Key> does not.
+template <typename Key, typename T,
+          typename Container = tree<Key, std::pair<const Key, T>>,
+          typename Compare = std::less<Key>>
 class Map {
+  static_assert(std::is_same<Compare, std::less<Key>>::value ||
+                    std::is_same<Compare, std::less<>>::value,
+                "Map orders keys with operator<");
+
  public:
   using key_type = Key;
   using mapped_type = T;
   using value_type = std::pair<const key_type, mapped_type>;
   using reference = value_type&;
   using const_reference = const value_type&;
-  using iterator = TreeIterator<Key, value_type>;
-  using const_iterator = TreeConstIterator<Key, value_type>;
+  using iterator = typename Container::iterator;
+  using const_iterator = typename Container::const_iterator;
   using size_type = size_t;
+  using key_compare = Compare;
 
   Map(){};
   Map(std::initializer_list<value_type> const& items) : tree_() {
     size_type n = items.size();
     if (n > max_size()) throw "Error max limit";
-    for (size_type i = 0; i < n; i++) {
-      insert(*(items.begin() + i));
-    }
+    tree_.insert(items.begin(), items.end(), true);
   };
 
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  Map(InputIt first, InputIt last) : tree_() {
+    tree_.insert(first, last, true);
+  }
+
   Map(const Map& other) : tree_(other.tree_){};
   Map(Map&& other) : tree_(std::move(other.tree_)){};
   ~Map() {}
@@ -43,36 +61,32 @@ class Map {
     return *this;
   }
 
-  T& at(const Key& key) {
-    T t{};
-    std::pair<Key, T> value(key, t);
-    iterator iter = find(value);
-    if (iter != nullptr)
-      return (*iter).second;
-    else
-      throw std::out_of_range("Iterator is pointing to nullptr");
+  // Lookups search by key alone. With a transparent Compare, the overloads
+  // taking K accept a key type that compares with Key (see
+  // RequireTransparentKey) without converting it.
+  T& at(const Key& key) { return MappedAt(tree_.find_key(key)); }
+
+  const T& at(const Key& key) const { return MappedAt(tree_.find_key(key)); }
+
+  template <typename K, typename = RequireTransparentKey<Compare, Key, K>>
+  T& at(const K& key) {
+    return MappedAt(tree_.find_key(key));
   }
 
-  const T& at(const Key& key) const {
-    T t{};
-    std::pair<Key, T> value(key, t);
-    iterator iter = find(value);
-    if (iter != nullptr)
-      return (*iter).second;
-    else
-      throw std::out_of_range("Iterator is pointing to nullptr");
+  template <typename K, typename = RequireTransparentKey<Compare, Key, K>>
+  const T& at(const K& key) const {
+    return MappedAt(tree_.find_key(key));
   }
 
-  T& operator[](const Key& key) {
-    T t{};
-    std::pair<Key, T> value(key, t);
-    return (*find(value)).second;
+  // Inserts a value-initialized T when the key is missing.
+  T& operator[](const Key& key) { return (*try_emplace(key).first).second; }
+
+  T& operator[](Key&& key) {
+    return (*try_emplace(std::move(key)).first).second;
   }
 
   const T& operator[](const Key& key) const {
-    T t{};
-    std::pair<Key, T> value(key, t);
-    return (*find(value)).second;
+    return (*tree_.find_key(key)).second;
   }
 
   iterator begin() { return tree_.begin(); }
@@ -92,86 +106,101 @@ class Map {
   void clear() { tree_.clear(); }
 
   std::pair<iterator, bool> insert(const value_type& value) {
-    bool flag = false;
-    std::pair<iterator, bool> pair(nullptr, flag);
-    if (find(value) == nullptr) {
-      pair.first = tree_.RecursionInsert(tree_.root_, value, nullptr, flag);
-      pair.second = flag;
-    }
-    return pair;
+    return tree_.insert_unique(value);
   }
 
   std::pair<iterator, bool> insert(const Key& key, const T& obj) {
-    const value_type value = std::pair<const key_type, mapped_type>(key, obj);
-    return insert(value);
-  }
-
-  std::pair<iterator, bool> insert_or_assign(const Key& key, const T& obj) {
-    bool flag = false;
-    std::pair<iterator, bool> pair(nullptr, flag);
-    const value_type value = std::pair<const key_type, mapped_type>(key, obj);
-    iterator res_find = find(value);
-    if (res_find == nullptr) {
-      pair.first = tree_.RecursionInsert(tree_.root_, value, nullptr, flag);
-      pair.second = flag;
-    } else {
-      res_find.unit->data.second = obj;
-      pair.first = res_find;
-    }
+    return try_emplace(key, obj);
+  }
+
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  void insert(InputIt first, InputIt last) {
+    tree_.insert(first, last, true);
+  }
+
+  // Builds T(args...) only when the key is missing, in the same descent
+  // that looks it up.
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+    return tree_.emplace_key(
+        key, std::piecewise_construct, std::forward_as_tuple(key),
+        std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(Key&& key, Args&&... args) {
+    return tree_.emplace_key(
+        key, std::piecewise_construct, std::forward_as_tuple(std::move(key)),
+        std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(const Key& key, M&& obj) {
+    std::pair<iterator, bool> pair = try_emplace(key, std::forward<M>(obj));
+    if (!pair.second) (*pair.first).second = std::forward<M>(obj);
     return pair;
   }
 
   void erase(iterator pos) { tree_.erase(pos); }
 
+  // Erases [first, last) and returns the element after it.
+  iterator erase(iterator first, iterator last) {
+    return tree_.erase(first, last);
+  }
+
   void swap(Map& other) { tree_.swap(other.tree_); }
 
   void merge(Map& other) { tree_.merge(other.tree_); }
 
-  bool contains(const Key& key) {
-    T y = {};
-    std::pair<Key, T> pair(key, y);
-    if (find(pair) != nullptr) return true;
-    return false;
+  iterator find(const Key& key) { return FoundOrEnd(tree_.find_key(key)); }
+
+  template <typename K, typename = RequireTransparentKey<Compare, Key, K>>
+  iterator find(const K& key) {
+    return FoundOrEnd(tree_.find_key(key));
+  }
+
+  bool contains(const Key& key) const {
+    return tree_.find_key(key) != nullptr;
+  }
+
+  template <typename K, typename = RequireTransparentKey<Compare, Key, K>>
+  bool contains(const K& key) const {
+    return tree_.find_key(key) != nullptr;
   }
 
+  iterator lower_bound(const Key& key) { return tree_.lower_bound(key); }
+
+  iterator upper_bound(const Key& key) { return tree_.upper_bound(key); }
+
+  std::pair<iterator, iterator> equal_range(const Key& key) {
+    return {tree_.lower_bound(key), tree_.upper_bound(key)};
+  }
+
+  size_type count(const Key& key) const { return tree_.count(key); }
+
   template <typename... Args>
   s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
     s21::vector<std::pair<iterator, bool>> my_vector;
-    iterator iter = begin();
-    bool flag = false;
-    std::pair<iterator, bool> pair(nullptr, flag);
     for (auto i : {std::forward<Args>(args)...}) {
-      flag = false;
-      iter.unit = nullptr;
-      if (find(i) == nullptr) {  // ИСКЛЮЧАЕТ ПОВТОРЕНИЯ (ДЛЯ Map)
-        pair.first = tree_.RecursionInsert(tree_.root_, i, nullptr, flag);
-        pair.second = flag;
-      } else {
-        pair.first = iter;
-        pair.second = flag;
-      }
-      my_vector.push_back(pair);
+      my_vector.push_back(tree_.insert_unique(i));
     }
     return my_vector;
   }
 
  private:
-  tree<Key, value_type> tree_;
-
-  iterator find(const value_type& value) const {
-    if (!tree_.root_) return nullptr;
-    TreeNode<Key, value_type>* tmp = tree_.root_;
-    while (tmp) {
-      if (value.first == tmp->data.first) {
-        return iterator(tmp);
-      } else if (value.first < tmp->data.first) {
-        tmp = tmp->left;
-      } else {
-        tmp = tmp->right;
-      }
+  static T& MappedAt(iterator iter) {
+    if (iter == nullptr) {
+      throw std::out_of_range("Iterator is pointing to nullptr");
     }
-    return nullptr;
+    return (*iter).second;
+  }
+
+  // find_key misses with a null iterator, which is not end() for tree.
+  iterator FoundOrEnd(iterator iter) {
+    return iter != nullptr ? iter : end();
   }
+
+  Container tree_;
 };
 
 }  // namespace s21
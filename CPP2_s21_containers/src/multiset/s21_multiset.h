@@ -13,12 +13,14 @@ class Multiset {
   using value_type = Key;
   using reference = value_type&;
   using const_reference = const value_type&;
-  using iterator = TreeIterator<Key, Key>;
-  using const_iterator = TreeConstIterator<Key, Key>;
+  using iterator = typename Container::iterator;
+  using const_iterator = typename Container::const_iterator;
   using size_type = size_t;
 
   Multiset() : tree_(){};
   Multiset(std::initializer_list<value_type> const& items) : tree_(items){};
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  Multiset(InputIt first, InputIt last) : tree_(first, last) {}
   Multiset(const Multiset& other) : tree_(other.tree_){};
   Multiset(Multiset&& other) : tree_(std::move(other.tree_)){};
   ~Multiset() {}
@@ -53,36 +55,82 @@ class Multiset {
     return tree_.insert(value);
   }
 
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  void insert(InputIt first, InputIt last) {
+    tree_.insert(first, last);
+  }
+
   void erase(iterator pos) { tree_.erase(pos); }
 
+  // Erases [first, last) and returns the element after it.
+  iterator erase(iterator first, iterator last) {
+    return tree_.erase(first, last);
+  }
+
   void swap(Multiset& other) { tree_.swap(other.tree_); }
 
-  void merge(Multiset& other) {
-    if (this == &other) return;
-    if (other.tree_.root_ == nullptr) return;
-    if (tree_.root_ == nullptr) {
-      swap(other);
-    } else {
-      s21::vector<iterator> pos_to_erase{};
-      iterator iter = other.begin();
-      for (; iter != nullptr; iter++) {
-        insert(iter.unit->data);
-        pos_to_erase.push_back(iter);
-      }
-      other.clear();
-    }
+  void merge(Multiset& other) { tree_.merge(other.tree_, false); }
+
+  // Repeated keys combine as the max, min or clamped difference of their
+  // counts, as in the std::set_* algorithms.
+  friend Multiset set_union(const Multiset& a, const Multiset& b) {
+    return Multiset(Container::Combine(a.tree_, b.tree_, SetOperation::kUnion));
+  }
+  friend Multiset set_union(Multiset&& a, Multiset&& b) {
+    return Multiset(Container::Combine(std::move(a.tree_), std::move(b.tree_),
+                                       SetOperation::kUnion));
+  }
+  friend Multiset set_intersection(const Multiset& a, const Multiset& b) {
+    return Multiset(
+        Container::Combine(a.tree_, b.tree_, SetOperation::kIntersection));
+  }
+  friend Multiset set_intersection(Multiset&& a, Multiset&& b) {
+    return Multiset(Container::Combine(std::move(a.tree_), std::move(b.tree_),
+                                       SetOperation::kIntersection));
+  }
+  friend Multiset set_difference(const Multiset& a, const Multiset& b) {
+    return Multiset(
+        Container::Combine(a.tree_, b.tree_, SetOperation::kDifference));
+  }
+  friend Multiset set_difference(Multiset&& a, Multiset&& b) {
+    return Multiset(Container::Combine(std::move(a.tree_), std::move(b.tree_),
+                                       SetOperation::kDifference));
   }
 
   const_iterator find(const Key& key) const { return tree_.find(key); }
 
   bool contains(const Key& key) { return tree_.contains(key); }
 
+  iterator lower_bound(const Key& key) { return tree_.lower_bound(key); }
+
+  iterator upper_bound(const Key& key) { return tree_.upper_bound(key); }
+
+  std::pair<iterator, iterator> equal_range(const Key& key) {
+    return {tree_.lower_bound(key), tree_.upper_bound(key)};
+  }
+
+  size_type count(const Key& key) const { return tree_.count(key); }
+
+  // Order statistics, O(log n) on tree and flat_tree: the k-th smallest
+  // element from 0, the number of keys less than key, and the number of
+  // keys in [lo, hi).
+  iterator nth(size_type k) const { return tree_.nth(k); }
+
+  size_type rank(const Key& key) const { return tree_.rank(key); }
+
+  size_type count_range(const Key& lo, const Key& hi) const {
+    if (!(lo < hi)) return 0;
+    return tree_.rank(hi) - tree_.rank(lo);
+  }
+
   template <typename... Args>
   s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
     return tree_.insert_many(std::forward<Args>(args)...);
   }
 
  private:
+  explicit Multiset(Container&& tree) : tree_(std::move(tree)) {}
+
   Container tree_;
 };
 
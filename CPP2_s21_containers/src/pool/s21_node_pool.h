@@ -0,0 +1,160 @@
+#ifndef CPP2_S21_CONTAINERS_S21_NODE_POOL_H_
+#define CPP2_S21_CONTAINERS_S21_NODE_POOL_H_
+
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace s21 {
+
+// Per-container slab allocator for fixed-size nodes. Slabs grow
+// geometrically, freed nodes go to an intrusive free list, and release()
+// returns every slab at once. Nodes never move between slabs, so pointers
+// stay valid until they are destroyed or the pool is released.
+template <class Node>
+class NodePool {
+ public:
+  NodePool()
+      : slabs_(nullptr),
+        last_slab_(nullptr),
+        free_(nullptr),
+        free_tail_(nullptr),
+        used_(0),
+        capacity_(0) {}
+  NodePool(const NodePool &) = delete;
+  NodePool(NodePool &&other) noexcept : NodePool() { swap(other); }
+  ~NodePool() { release(); }
+
+  NodePool &operator=(const NodePool &) = delete;
+  NodePool &operator=(NodePool &&other) noexcept {
+    if (this != &other) {
+      release();
+      swap(other);
+    }
+    return *this;
+  }
+
+  template <class... Args>
+  Node *create(Args &&...args) {
+    Slot *slot = allocate();
+    try {
+      return new (slot->storage) Node(std::forward<Args>(args)...);
+    } catch (...) {
+      push_free(slot);
+      throw;
+    }
+  }
+
+  void destroy(Node *node) {
+    if (!node) return;
+    node->~Node();
+    push_free(reinterpret_cast<Slot *>(node));
+  }
+
+  // Frees all slabs without running destructors: every node must already
+  // be destroyed or trivially destructible.
+  void release() {
+    while (slabs_) {
+      Slab *next = slabs_->next;
+      ::operator delete(slabs_);
+      slabs_ = next;
+    }
+    last_slab_ = nullptr;
+    free_ = free_tail_ = nullptr;
+    used_ = capacity_ = 0;
+  }
+
+  // Takes ownership of all of other's slabs, so nodes created by other stay
+  // valid after they are relinked into this pool's container. Runs in
+  // constant time: slab and free lists are spliced through their tails.
+  void adopt(NodePool &other) {
+    if (this == &other || !other.slabs_) return;
+    if (slabs_) {
+      // Keep the current bump slab at the head of the list, and turn
+      // other's unused bump tail into ordinary free slots.
+      other.last_slab_->next = slabs_->next;
+      if (!slabs_->next) last_slab_ = other.last_slab_;
+      slabs_->next = other.slabs_;
+      for (size_t i = other.used_; i < other.capacity_; i++) {
+        push_free(other.slabs_->slots() + i);
+      }
+    } else {
+      slabs_ = other.slabs_;
+      last_slab_ = other.last_slab_;
+      used_ = other.used_;
+      capacity_ = other.capacity_;
+    }
+    if (other.free_) {
+      other.free_tail_->next = free_;
+      if (!free_) free_tail_ = other.free_tail_;
+      free_ = other.free_;
+    }
+    other.slabs_ = other.last_slab_ = nullptr;
+    other.free_ = other.free_tail_ = nullptr;
+    other.used_ = other.capacity_ = 0;
+  }
+
+  void swap(NodePool &other) noexcept {
+    std::swap(slabs_, other.slabs_);
+    std::swap(last_slab_, other.last_slab_);
+    std::swap(free_, other.free_);
+    std::swap(free_tail_, other.free_tail_);
+    std::swap(used_, other.used_);
+    std::swap(capacity_, other.capacity_);
+  }
+
+ private:
+  union Slot {
+    Slot *next;
+    alignas(Node) unsigned char storage[sizeof(Node)];
+  };
+
+  struct alignas(Slot) Slab {
+    Slab *next;
+    Slot *slots() { return reinterpret_cast<Slot *>(this + 1); }
+  };
+
+  static_assert(alignof(Slot) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__,
+                "Over-aligned nodes are not supported");
+
+  static constexpr size_t kFirstSlab = 16;
+  static constexpr size_t kMaxSlab = 4096;
+
+  void push_free(Slot *slot) {
+    if (!free_) free_tail_ = slot;
+    slot->next = free_;
+    free_ = slot;
+  }
+
+  Slot *allocate() {
+    if (free_) {
+      Slot *slot = free_;
+      free_ = free_->next;
+      if (!free_) free_tail_ = nullptr;
+      return slot;
+    }
+    if (used_ == capacity_) {
+      size_t capacity = capacity_ ? capacity_ * 2 : kFirstSlab;
+      if (capacity > kMaxSlab) capacity = kMaxSlab;
+      Slab *slab = static_cast<Slab *>(
+          ::operator new(sizeof(Slab) + capacity * sizeof(Slot)));
+      slab->next = slabs_;
+      if (!slabs_) last_slab_ = slab;
+      slabs_ = slab;
+      used_ = 0;
+      capacity_ = capacity;
+    }
+    return slabs_->slots() + used_++;
+  }
+
+  Slab *slabs_;
+  Slab *last_slab_;
+  Slot *free_;
+  Slot *free_tail_;
+  size_t used_;
+  size_t capacity_;
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_NODE_POOL_H_
@@ -2,89 +2,32 @@
 #define S21_QUEUE_H
 
 #include <cstddef>
+#include <initializer_list>
 #include <iostream>
 #include <utility>
 
-namespace s21 {
+#include "../ring_buffer/s21_ring_buffer.h"
 
-template <class T>
-struct QueueNode {
-  QueueNode<T> *pPrev;
-  QueueNode<T> *pNext;
-  T key;
-  QueueNode() : pPrev(nullptr), pNext(nullptr) {}
-  // QueueNode(T i) : pPrev(nullptr), pNext(nullptr), key(i) {}
-  QueueNode(T i, QueueNode<T> *p, QueueNode<T> *n)
-      : pPrev(p), pNext(n), key(i) {}
-};
+namespace s21 {
 
-template <class T>
+// FIFO adaptor. Container needs push_back, emplace_back, pop_front, front,
+// back, size and swap; the default ring_buffer keeps the elements in one
+// growing circular array.
+template <class T, class Container = ring_buffer<T>>
 class queue {
  public:
-  queue() : pFront(nullptr), pBack(nullptr), size_cont(0) {}
-
-  queue(std::initializer_list<T> const &items)
-      : pFront(nullptr), pBack(nullptr), size_cont(0) {
-    for (auto i : items) {
-      this->push(i);
-      // size_cont++;
-      // QueueNode<T> *n = new QueueNode<T>(i, pBack, nullptr);
-      // if (pBack != nullptr) {
-      //   pBack->pNext = n;
-      // } else {
-      //   pFront = n;
-      // }
-      // pBack = n;
-    }
-  }
+  queue() {}
 
-  queue(const queue &q) {
-    pFront = nullptr;
-    pBack = nullptr;
-    size_cont = 0;
-    QueueNode<T> *n = q.pFront;
-    while (n != nullptr) {
-      push(n->key);
-      n = n->pNext;
-      // size_cont++;
-      // QueueNode<T> *n1 = new QueueNode<T>(n->key, pBack, nullptr);
-      // if (pBack != nullptr) {
-      //   pBack->pNext = n1;
-      // } else {
-      //   pFront = n1;
-      // }
-      // pBack = n1;
-      // n = n->pNext;
-    }
-  }
+  queue(std::initializer_list<T> const &items) : c_(items) {}
 
-  queue(queue &&q) noexcept {
-    pFront = q.pFront;
-    pBack = q.pBack;
-    size_cont = q.size_cont;
-    q.pFront = nullptr;
-    q.pBack = nullptr;
-    q.size_cont = 0;
-  }
+  queue(const queue &q) : c_(q.c_) {}
 
-  ~queue() {
-    while (pFront != nullptr) {
-      this->pop();
-    }
-  }
+  queue(queue &&q) noexcept : c_(std::move(q.c_)) {}
+
+  ~queue() {}
 
   queue &operator=(queue &&q) noexcept {
-    if (pFront != nullptr) {
-      while (pFront != nullptr) {
-        this->pop();
-      }
-    }
-    pFront = q.pFront;
-    pBack = q.pBack;
-    size_cont = q.size_cont;
-    q.pFront = nullptr;
-    q.pBack = nullptr;
-    q.size_cont = 0;
+    c_ = std::move(q.c_);
     return *this;
   }
 
@@ -92,74 +35,39 @@ class queue {
     if (this == &q) {
       return *this;
     }
-    while (pFront != nullptr) {
-      this->pop();
-    }
-    pBack = nullptr;
-    QueueNode<T> *n = q.pFront;
-    while (n != nullptr) {
-      push(n->key);
-      n = n->pNext;
-    }
+    c_ = q.c_;
     return *this;
   }
 
-  const T &front() { return pFront->key; }
-  const T &back() { return pBack->key; }
+  const T &front() { return c_.front(); }
+  const T &back() { return c_.back(); }
 
-  bool empty() const {
-    if (size_cont == 0) {
-      return true;
-    }
-    return false;
-  }
+  bool empty() const { return c_.size() == 0; }
 
-  size_t size() const { return size_cont; }
+  size_t size() const { return c_.size(); }
 
-  void push(const T &value) {
-    size_cont++;
-    QueueNode<T> *n = new QueueNode<T>(value, pBack, nullptr);
-    if (pBack != nullptr) {
-      pBack->pNext = n;
-    } else {
-      pFront = n;
-    }
-    pBack = n;
-  }
+  void push(const T &value) { c_.push_back(value); }
+
+  void push(T &&value) { c_.push_back(std::move(value)); }
 
   void pop() {
-    if (pFront != nullptr) {
-      size_cont--;
-      QueueNode<T> *temp = pFront;
-      pFront = pFront->pNext;
-      if (pFront == nullptr) {
-        pBack = nullptr;
-      }
-      delete temp;
-    }
+    if (c_.size() != 0) c_.pop_front();
   }
 
-  void swap(queue &rotate) {
-    queue tmp = rotate;
-    rotate = *this;
-    *this = tmp;
-  }
+  void swap(queue &rotate) { c_.swap(rotate.c_); }
 
+  // Appends each argument as a separate element.
   template <class... Args>
   void emplace_back(Args &&...args) {
-    for (auto data : {args...}) {
-      push(data);
-    }
+    (c_.emplace_back(std::forward<Args>(args)), ...);
   }
 
   const T &get_start_element() { return this->front(); }
 
  private:
-  QueueNode<T> *pFront;
-  QueueNode<T> *pBack;
-  size_t size_cont;
+  Container c_;
 };
 
 }  // namespace s21
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,230 @@
+#ifndef CPP2_S21_CONTAINERS_S21_RING_BUFFER_H_
+#define CPP2_S21_CONTAINERS_S21_RING_BUFFER_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// Double-ended circular buffer in one contiguous allocation, the default
+// backend of queue and stack. The capacity is a power of two, so positions
+// wrap with a mask, and it doubles when full: once the buffer has grown to
+// the working set, pushes and pops never allocate.
+template <class T>
+class ring_buffer {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  ring_buffer() : data_(nullptr), head_(0), size_(0), cap_(0) {}
+
+  ring_buffer(std::initializer_list<T> const &items) : ring_buffer() {
+    reserve(items.size());
+    for (const T &item : items) push_back(item);
+  }
+
+  ring_buffer(const ring_buffer &other) : ring_buffer() {
+    reserve(other.size_);
+    for (size_type i = 0; i < other.size_; i++) push_back(other[i]);
+  }
+
+  ring_buffer(ring_buffer &&other) noexcept : ring_buffer() { swap(other); }
+
+  ~ring_buffer() {
+    clear();
+    Deallocate(data_, cap_);
+  }
+
+  ring_buffer &operator=(const ring_buffer &other) {
+    if (this != &other) {
+      ring_buffer tmp(other);
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  ring_buffer &operator=(ring_buffer &&other) noexcept {
+    if (this != &other) {
+      ring_buffer tmp(std::move(other));
+      swap(tmp);
+    }
+    return *this;
+  }
+
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+  size_type capacity() const { return cap_; }
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max() / sizeof(T) / 2;
+  }
+
+  // Element i counted from the front.
+  reference operator[](size_type i) { return data_[(head_ + i) & (cap_ - 1)]; }
+  const_reference operator[](size_type i) const {
+    return data_[(head_ + i) & (cap_ - 1)];
+  }
+
+  reference front() { return (*this)[0]; }
+  const_reference front() const { return (*this)[0]; }
+  reference back() { return (*this)[size_ - 1]; }
+  const_reference back() const { return (*this)[size_ - 1]; }
+
+  void push_back(const_reference value) { emplace_back(value); }
+  void push_back(T &&value) { emplace_back(std::move(value)); }
+  void push_front(const_reference value) { emplace_front(value); }
+  void push_front(T &&value) { emplace_front(std::move(value)); }
+
+  template <class... Args>
+  reference emplace_back(Args &&...args) {
+    if (size_ == cap_) {
+      Grow(false, std::forward<Args>(args)...);
+    } else {
+      new (&(*this)[size_]) T(std::forward<Args>(args)...);
+    }
+    size_++;
+    return back();
+  }
+
+  template <class... Args>
+  reference emplace_front(Args &&...args) {
+    if (size_ == cap_) {
+      Grow(true, std::forward<Args>(args)...);
+    } else {
+      new (&data_[(head_ - 1) & (cap_ - 1)]) T(std::forward<Args>(args)...);
+      head_ = (head_ - 1) & (cap_ - 1);
+    }
+    size_++;
+    return front();
+  }
+
+  void pop_front() {
+    if (size_ == 0) return;
+    front().~T();
+    head_ = (head_ + 1) & (cap_ - 1);
+    size_--;
+  }
+
+  void pop_back() {
+    if (size_ == 0) return;
+    back().~T();
+    size_--;
+  }
+
+  void clear() {
+    while (size_) pop_back();
+    head_ = 0;
+  }
+
+  void reserve(size_type n) {
+    if (n <= cap_) return;
+    Relocate(Capacity(n));
+  }
+
+  void swap(ring_buffer &other) noexcept {
+    std::swap(data_, other.data_);
+    std::swap(head_, other.head_);
+    std::swap(size_, other.size_);
+    std::swap(cap_, other.cap_);
+  }
+
+ private:
+  static constexpr size_type kMinCapacity = 8;
+
+  static T *Allocate(size_type n) { return std::allocator<T>().allocate(n); }
+  static void Deallocate(T *ptr, size_type n) {
+    if (ptr) std::allocator<T>().deallocate(ptr, n);
+  }
+
+  // Smallest power of two that holds n elements.
+  size_type Capacity(size_type n) const {
+    if (n > max_size()) throw std::length_error("ring_buffer is too large");
+    size_type cap = kMinCapacity;
+    while (cap < n) cap *= 2;
+    return cap;
+  }
+
+  // Constructs the elements, unwrapped, at ptr[0, size_): moved when that
+  // cannot throw and copied otherwise. On an exception nothing is left
+  // constructed at ptr.
+  void MoveInto(T *ptr) {
+    if constexpr (std::is_trivially_copyable<T>::value) {
+      size_type first = std::min(size_, cap_ - head_);
+      if (size_) {
+        std::memcpy(ptr, data_ + head_, first * sizeof(T));
+        std::memcpy(ptr + first, data_, (size_ - first) * sizeof(T));
+      }
+    } else {
+      size_type i = 0;
+      try {
+        for (; i < size_; i++) {
+          new (ptr + i) T(std::move_if_noexcept((*this)[i]));
+        }
+      } catch (...) {
+        std::destroy(ptr, ptr + i);
+        throw;
+      }
+    }
+  }
+
+  // Takes over a buffer that already holds the elements.
+  void Replace(T *ptr, size_type new_cap, size_type head) {
+    for (size_type i = 0; i < size_; i++) (*this)[i].~T();
+    Deallocate(data_, cap_);
+    data_ = ptr;
+    cap_ = new_cap;
+    head_ = head;
+  }
+
+  void Relocate(size_type new_cap) {
+    T *ptr = Allocate(new_cap);
+    try {
+      MoveInto(ptr);
+    } catch (...) {
+      Deallocate(ptr, new_cap);
+      throw;
+    }
+    Replace(ptr, new_cap, 0);
+  }
+
+  // Doubles the capacity of a full buffer and adds one element at the
+  // back, or at the front when to_front is set. The new element is built
+  // before the old ones move, so args may refer to one of them.
+  template <class... Args>
+  void Grow(bool to_front, Args &&...args) {
+    size_type new_cap = Capacity(cap_ ? cap_ * 2 : kMinCapacity);
+    T *ptr = Allocate(new_cap);
+    T *slot = to_front ? ptr + new_cap - 1 : ptr + size_;
+    try {
+      new (slot) T(std::forward<Args>(args)...);
+      try {
+        MoveInto(ptr);
+      } catch (...) {
+        slot->~T();
+        throw;
+      }
+    } catch (...) {
+      Deallocate(ptr, new_cap);
+      throw;
+    }
+    Replace(ptr, new_cap, to_front ? new_cap - 1 : 0);
+  }
+
+  T *data_;
+  size_type head_;
+  size_type size_;
+  size_type cap_;
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_RING_BUFFER_H_
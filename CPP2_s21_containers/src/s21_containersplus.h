@@ -2,6 +2,13 @@
 #define CPP2_S21_CONTAINERS_S21_CONTAINERSPLUS_H_
 
 #include "array/s21_array.h"
+#include "counted_multiset/s21_counted_multiset.h"
+#include "flat_map/s21_flat_map.h"
+#include "flat_set/s21_flat_set.h"
 #include "multiset/s21_multiset.h"
+#include "ring_buffer/s21_ring_buffer.h"
+#include "small_vector/s21_small_vector.h"
+#include "unordered_map/s21_unordered_map.h"
+#include "unordered_set/s21_unordered_set.h"
 
 #endif  // CPP2_S21_CONTAINERS_S21_CONTAINERSPLUS_H_
\ No newline at end of file
@@ -13,19 +13,22 @@ class Set {
   using value_type = Key;
   using reference = value_type&;
   using const_reference = const value_type&;
-  using iterator = TreeIterator<Key, Key>;
-  using const_iterator = TreeConstIterator<Key, Key>;
+  using iterator = typename Container::iterator;
+  using const_iterator = typename Container::const_iterator;
   using size_type = size_t;
 
   Set() : tree_(){};
   Set(std::initializer_list<value_type> const& items) : tree_() {
     size_type n = items.size();
     if (n > max_size()) throw "Error max limit";
-    for (size_type i = 0; i < n; i++) {
-      insert(*(items.begin() + i));
-    }
+    tree_.insert(items.begin(), items.end(), true);
   };
 
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  Set(InputIt first, InputIt last) : tree_() {
+    tree_.insert(first, last, true);
+  }
+
   Set(const Set& other) : tree_(other.tree_){};
   Set(Set&& other) : tree_(std::move(other.tree_)){};
   ~Set() {}
@@ -57,47 +60,88 @@ class Set {
   void clear() { tree_.clear(); }
 
   std::pair<iterator, bool> insert(const value_type& value) {
-    bool flag = false;
-    std::pair<iterator, bool> pair(nullptr, flag);
-    if (find(value) == nullptr) {
-      pair.first = tree_.RecursionInsert(tree_.root_, value, nullptr, flag);
-      pair.second = flag;
-    }
-    return pair;
+    return tree_.insert_unique(value);
+  }
+
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  void insert(InputIt first, InputIt last) {
+    tree_.insert(first, last, true);
   }
 
   void erase(iterator pos) { tree_.erase(pos); }
 
+  // Erases [first, last) and returns the element after it.
+  iterator erase(iterator first, iterator last) {
+    return tree_.erase(first, last);
+  }
+
   void swap(Set& other) { tree_.swap(other.tree_); }
 
   void merge(Set& other) { tree_.merge(other.tree_); }
 
+  // Computed by Container::Combine. The rvalue overloads leave both
+  // operands empty and may reuse their storage.
+  friend Set set_union(const Set& a, const Set& b) {
+    return Set(Container::Combine(a.tree_, b.tree_, SetOperation::kUnion));
+  }
+  friend Set set_union(Set&& a, Set&& b) {
+    return Set(Container::Combine(std::move(a.tree_), std::move(b.tree_),
+                                  SetOperation::kUnion));
+  }
+  friend Set set_intersection(const Set& a, const Set& b) {
+    return Set(
+        Container::Combine(a.tree_, b.tree_, SetOperation::kIntersection));
+  }
+  friend Set set_intersection(Set&& a, Set&& b) {
+    return Set(Container::Combine(std::move(a.tree_), std::move(b.tree_),
+                                  SetOperation::kIntersection));
+  }
+  friend Set set_difference(const Set& a, const Set& b) {
+    return Set(Container::Combine(a.tree_, b.tree_, SetOperation::kDifference));
+  }
+  friend Set set_difference(Set&& a, Set&& b) {
+    return Set(Container::Combine(std::move(a.tree_), std::move(b.tree_),
+                                  SetOperation::kDifference));
+  }
+
   const_iterator find(const Key& key) const { return tree_.find(key); }
 
   bool contains(const Key& key) { return tree_.contains(key); }
 
+  iterator lower_bound(const Key& key) { return tree_.lower_bound(key); }
+
+  iterator upper_bound(const Key& key) { return tree_.upper_bound(key); }
+
+  std::pair<iterator, iterator> equal_range(const Key& key) {
+    return {tree_.lower_bound(key), tree_.upper_bound(key)};
+  }
+
+  size_type count(const Key& key) const { return tree_.count(key); }
+
+  // Order statistics, O(log n) on tree and flat_tree: the k-th smallest
+  // element from 0, the number of keys less than key, and the number of
+  // keys in [lo, hi).
+  iterator nth(size_type k) const { return tree_.nth(k); }
+
+  size_type rank(const Key& key) const { return tree_.rank(key); }
+
+  size_type count_range(const Key& lo, const Key& hi) const {
+    if (!(lo < hi)) return 0;
+    return tree_.rank(hi) - tree_.rank(lo);
+  }
+
   template <typename... Args>
   s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
     s21::vector<std::pair<iterator, bool>> my_vector;
-    iterator iter = begin();
-    bool flag = false;
-    std::pair<iterator, bool> pair(nullptr, flag);
     for (auto i : {std::forward<Args>(args)...}) {
-      flag = false;
-      iter.unit = nullptr;
-      if (find(i) == nullptr) {  // ИСКЛЮЧАЕТ ПОВТОРЕНИЯ (ДЛЯ Set)
-        pair.first = tree_.RecursionInsert(tree_.root_, i, nullptr, flag);
-        pair.second = flag;
-      } else {
-        pair.first = iter;
-        pair.second = flag;
-      }
-      my_vector.push_back(pair);
+      my_vector.push_back(tree_.insert_unique(i));
     }
     return my_vector;
   }
 
  private:
+  explicit Set(Container&& tree) : tree_(std::move(tree)) {}
+
   Container tree_;
 };
 
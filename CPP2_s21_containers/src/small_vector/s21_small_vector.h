@@ -0,0 +1,18 @@
+#ifndef CPP2_S21_CONTAINERS_S21_SMALL_VECTOR_H_
+#define CPP2_S21_CONTAINERS_S21_SMALL_VECTOR_H_
+
+#include <cstddef>
+
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+// vector that keeps up to N elements inside the object and only allocates
+// when it grows past them. shrink_to_fit moves the elements back inline
+// once they fit again.
+template <typename T, size_t N>
+using small_vector = vector<T, N>;
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_SMALL_VECTOR_H_
@@ -2,73 +2,39 @@
 #define S21_STACK_H
 
 #include <cstddef>
+#include <initializer_list>
 #include <iostream>
+#include <stdexcept>
 #include <utility>
 
+#include "../ring_buffer/s21_ring_buffer.h"
+
 namespace s21 {
-template <class T>
-struct S_Node {
-  S_Node<T> *sPrev;
-  S_Node<T> *sNext;
-  T key;
-  S_Node() : sNext(nullptr), sPrev(nullptr) {}
-  S_Node(T i, S_Node<T> *p, S_Node<T> *n) : sPrev(p), sNext(n), key(i) {}
-};
 
-template <class T>
+// LIFO adaptor over the back of Container, which needs push_back,
+// emplace_back, pop_back, back, size and swap. The default ring_buffer
+// keeps the elements in one growing array.
+template <class T, class Container = ring_buffer<T>>
 class stack {
  public:
-  stack() : sFront(nullptr), sBack(nullptr), size_cont(0) {}
+  stack() {}
 
-  stack(std::initializer_list<T> const &items)
-      : sFront(nullptr), sBack(nullptr), size_cont(0) {
-    for (auto i : items) {
-      push(i);
-    }
-  }
+  stack(std::initializer_list<T> const &items) : c_(items) {}
 
-  stack(const stack &q) : sFront(nullptr), sBack(nullptr), size_cont(0) {
-    S_Node<T> *n = q.sFront;
-    while (n != nullptr) {
-      push(n->key);
-      n = n->sNext;
-    }
-  }
+  stack(const stack &q) : c_(q.c_) {}
 
-  stack(stack &&q) noexcept
-      : sFront(q.sFront), sBack(q.sBack), size_cont(q.size_cont) {
-    q.sFront = q.sBack = nullptr;
-    q.size_cont = 0;
-  }
+  stack(stack &&q) noexcept : c_(std::move(q.c_)) {}
 
-  ~stack() {
-    while (sFront != nullptr) {
-      this->pop();
-    }
-  }
+  ~stack() {}
 
   stack &operator=(stack &&q) noexcept {
-    if (sFront != nullptr) {
-      this->~stack();
-    }
-    sFront = q.sFront;
-    sBack = q.sBack;
-    size_cont = q.size_cont;
-    q.sFront = q.sBack = nullptr;
-    q.size_cont = 0;
+    c_ = std::move(q.c_);
     return *this;
   }
 
   stack &operator=(const stack &q) {
-    if (this->sFront == q.sFront) return *this;
-    if (sFront != nullptr) {
-      this->~stack();
-    }
-    S_Node<T> *n = q.sFront;
-    while (n != nullptr) {
-      this->push(n->key);
-      n = n->sNext;
-    }
+    if (this == &q) return *this;
+    c_ = q.c_;
     return *this;
   }
 
@@ -76,61 +42,34 @@ class stack {
     if (empty()) {
       throw std::out_of_range("Error: Stack is Empty");
     }
-    return sBack->key;
+    return c_.back();
   }
 
-  bool empty() const {
-    if (size_cont == 0) {
-      return true;
-    }
-    return false;
-  }
+  bool empty() const { return c_.size() == 0; }
 
-  size_t size() const { return size_cont; }
+  size_t size() const { return c_.size(); }
 
-  void push(const T &value) {
-    size_cont++;
-    S_Node<T> *n = new S_Node<T>(value, sBack, nullptr);
-    if (sBack != nullptr) {
-      sBack->sNext = n;
-    } else {
-      sFront = n;
-    }
-    sBack = n;
-  }
+  void push(const T &value) { c_.push_back(value); }
+
+  void push(T &&value) { c_.push_back(std::move(value)); }
 
   void pop() {
-    if (sFront != nullptr) {
-      size_cont--;
-      S_Node<T> *temp = sBack;
-      sBack = sBack->sPrev;
-      delete temp;
-      if (sBack == nullptr) {
-        sFront = nullptr;
-      }
-    }
+    if (c_.size() != 0) c_.pop_back();
   }
 
-  void swap(stack &rotate) {
-    stack temp = rotate;
-    rotate = *this;
-    *this = temp;
-  }
+  void swap(stack &rotate) { c_.swap(rotate.c_); }
 
+  // Pushes each argument in turn, so the last one ends up on top.
   template <class... Args>
   void emplace_front(Args &&...args) {
-    for (auto data : {args...}) {
-      push(data);
-    }
+    (c_.emplace_back(std::forward<Args>(args)), ...);
   }
 
   const T &get_start_element() const { return this->top(); }
 
  private:
-  S_Node<T> *sFront;
-  S_Node<T> *sBack;
-  size_t size_cont;
+  Container c_;
 };
 }  // namespace s21
 
-#endif
\ No newline at end of file
+#endif
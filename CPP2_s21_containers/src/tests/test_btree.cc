@@ -0,0 +1,262 @@
+#include <gtest/gtest.h>
+
+#include <iterator>
+#include <map>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../btree/s21_btree.h"
+#include "../map/s21_map.h"
+#include "../multiset/s21_multiset.h"
+#include "../set/s21_set.h"
+
+// Three values per node, so that a few hundred keys already give a deep
+// tree and every split, rotation and merge path runs.
+using SmallTree = s21::btree<int, int, 1>;
+using BTreeSet = s21::Set<int, s21::btree<int, int>>;
+using BTreeMultiset = s21::Multiset<int, s21::btree<int, int>>;
+using BTreeMap =
+    s21::Map<int, std::string,
+             s21::btree<int, std::pair<const int, std::string>>>;
+
+template <typename Tree, typename Std>
+bool SameElements(Tree& tree, const Std& expected) {
+  if (tree.size() != expected.size()) return false;
+  auto iter = tree.begin();
+  for (const auto& value : expected) {
+    if (iter == tree.end() || !(*iter == value)) return false;
+    ++iter;
+  }
+  return iter == tree.end();
+}
+
+TEST(BTree, empty) {
+  SmallTree T;
+  ASSERT_TRUE(T.empty());
+  ASSERT_TRUE(T.begin() == T.end());
+  ASSERT_TRUE(T.begin() == nullptr);
+  ASSERT_FALSE(T.contains(1));
+  ASSERT_THROW(*T.begin(), std::runtime_error);
+}
+
+TEST(BTree, random_insert_erase_against_multiset) {
+  std::mt19937 gen(5);
+  std::uniform_int_distribution<int> key(0, 400);
+  SmallTree T;
+  std::multiset<int> S;
+  for (int i = 0; i < 20000; i++) {
+    int k = key(gen);
+    if (gen() % 2) {
+      T.insert(k);
+      S.insert(k);
+    } else {
+      auto found = T.find_key(k);
+      ASSERT_EQ(found != nullptr, S.count(k) > 0);
+      if (found != nullptr) {
+        T.erase(found);
+        S.erase(S.find(k));
+      }
+    }
+  }
+  ASSERT_TRUE(SameElements(T, S));
+  std::vector<int> backwards;
+  auto iter = T.begin();
+  for (size_t i = 1; i < T.size(); i++) ++iter;
+  for (; iter != nullptr; --iter) backwards.push_back(*iter);
+  ASSERT_TRUE(std::equal(backwards.begin(), backwards.end(), S.rbegin()));
+  ASSERT_EQ(backwards.size(), S.size());
+  while (!T.empty()) T.erase(T.begin());
+  ASSERT_TRUE(T.begin() == nullptr);
+}
+
+TEST(BTree, sorted_and_reverse_loads) {
+  SmallTree up, down;
+  std::set<int> S;
+  for (int i = 0; i < 1000; i++) {
+    up.insert_unique(i);
+    down.insert_unique(999 - i);
+    S.insert(i);
+  }
+  ASSERT_TRUE(SameElements(up, S));
+  ASSERT_TRUE(SameElements(down, S));
+  for (int i = 0; i < 1000; i += 3) {
+    up.erase(up.find_key(i));
+    S.erase(i);
+  }
+  ASSERT_TRUE(SameElements(up, S));
+}
+
+TEST(BTree, copy_move_and_bulk) {
+  std::vector<int> keys;
+  for (int i = 0; i < 500; i++) keys.push_back((i * 37) % 250);
+  SmallTree T(keys.begin(), keys.end());
+  std::multiset<int> S(keys.begin(), keys.end());
+  ASSERT_TRUE(SameElements(T, S));
+  SmallTree copy(T);
+  SmallTree moved(std::move(T));
+  ASSERT_TRUE(T.empty());
+  ASSERT_TRUE(SameElements(copy, S));
+  ASSERT_TRUE(SameElements(moved, S));
+  SmallTree unique;
+  unique.insert(keys.begin(), keys.end(), true);
+  unique.insert(keys.begin(), keys.end(), true);
+  ASSERT_TRUE(SameElements(unique, std::set<int>(keys.begin(), keys.end())));
+  T = moved;
+  T.insert(1000);
+  ASSERT_EQ(T.size(), moved.size() + 1);
+}
+
+// Every copy or move counts against a shared budget and throws once it
+// runs out; a moved-from value turns negative.
+struct Fragile {
+  static int budget;
+  int value;
+  Fragile(int v = 0) : value(v) {}
+  Fragile(const Fragile& other) : value(other.value) { Spend(); }
+  Fragile(Fragile&& other) : value(other.value) {
+    Spend();
+    other.value = -1;
+  }
+  Fragile& operator=(const Fragile&) = default;
+  Fragile& operator=(Fragile&&) = default;
+  bool operator<(const Fragile& other) const { return value < other.value; }
+  static void Spend() {
+    if (budget-- == 0) throw std::runtime_error("out of budget");
+  }
+};
+int Fragile::budget = 0;
+
+TEST(BTree, bulk_insert_keeps_values_on_throw) {
+  Fragile::budget = 1 << 30;
+  s21::btree<Fragile, Fragile, 1> T;
+  for (int i = 0; i < 100; i += 2) T.insert(Fragile(i));
+  std::vector<Fragile> batch;
+  for (int i = 1; i < 100; i += 2) batch.push_back(Fragile(i));
+  // The batch is copied first; the merge then runs out part way through.
+  Fragile::budget = 60;
+  ASSERT_THROW(T.insert(batch.begin(), batch.end()), std::runtime_error);
+  Fragile::budget = 1 << 30;
+  ASSERT_EQ(T.size(), 50u);
+  int expected = 0;
+  for (auto iter = T.begin(); iter != nullptr; ++iter, expected += 2) {
+    ASSERT_EQ((*iter).value, expected);
+  }
+  ASSERT_EQ(expected, 100);
+}
+
+TEST(BTree, set_backend) {
+  BTreeSet S1{5, 1, 3, 3, 9};
+  std::set<int> S2{5, 1, 3, 3, 9};
+  ASSERT_TRUE(SameElements(S1, S2));
+  auto res = S1.insert(3);
+  ASSERT_FALSE(res.second);
+  ASSERT_EQ(*res.first, 3);
+  ASSERT_TRUE(S1.insert(4).second);
+  S2.insert(4);
+  ASSERT_TRUE(S1.contains(4));
+  ASSERT_TRUE(S1.find(7) == nullptr);
+  S1.erase(S1.begin());
+  S2.erase(S2.begin());
+  ASSERT_TRUE(SameElements(S1, S2));
+
+  BTreeSet S3{4, 5, 6, 10};
+  std::set<int> S4{4, 5, 6, 10};
+  S1.merge(S3);
+  S2.merge(S4);
+  ASSERT_TRUE(SameElements(S1, S2));
+  ASSERT_TRUE(SameElements(S3, S4));
+  BTreeSet U = set_union(S1, S3);
+  ASSERT_TRUE(SameElements(U, S2));
+  BTreeSet I = set_intersection(std::move(S1), std::move(S3));
+  ASSERT_TRUE(SameElements(I, std::set<int>{4, 5}));
+  ASSERT_TRUE(S1.empty());
+}
+
+TEST(BTree, multiset_backend) {
+  BTreeMultiset S1{2, 2, 1};
+  std::multiset<int> S2{2, 2, 1};
+  S1.insert(2);
+  S2.insert(2);
+  S1.insert_many(0, 1);
+  S2.insert({0, 1});
+  ASSERT_TRUE(SameElements(S1, S2));
+  BTreeMultiset S3{2, 7};
+  S1.merge(S3);
+  S2.insert({2, 7});
+  ASSERT_TRUE(SameElements(S1, S2));
+  ASSERT_TRUE(S3.empty());
+}
+
+TEST(BTree, bounds_and_range_erase) {
+  s21::Multiset<int, s21::btree<int, int, 1>> S1;
+  std::multiset<int> S2;
+  std::mt19937 gen(11);
+  std::uniform_int_distribution<int> dist(0, 99);
+  for (int i = 0; i < 3000; i++) {
+    int key = dist(gen);
+    S1.insert(key);
+    S2.insert(key);
+  }
+  for (int key = -1; key <= 100; key++) {
+    ASSERT_EQ(S1.count(key), S2.count(key));
+    auto lower = S2.lower_bound(key);
+    auto upper = S2.upper_bound(key);
+    ASSERT_EQ(S1.lower_bound(key) == nullptr, lower == S2.end());
+    ASSERT_EQ(S1.upper_bound(key) == nullptr, upper == S2.end());
+    if (lower != S2.end()) {
+      ASSERT_EQ(*S1.lower_bound(key), *lower);
+    }
+    if (upper != S2.end()) {
+      ASSERT_EQ(*S1.upper_bound(key), *upper);
+    }
+  }
+  // Starts in the middle of a run of equal keys.
+  for (int lo = 5; lo < 95; lo += 10) {
+    auto first1 = S1.lower_bound(lo);
+    auto first2 = S2.lower_bound(lo);
+    std::advance(first1, 3);
+    std::advance(first2, 3);
+    auto next = S1.erase(first1, S1.lower_bound(lo + 4));
+    S2.erase(first2, S2.lower_bound(lo + 4));
+    ASSERT_EQ(*next, *S2.lower_bound(lo + 4));
+  }
+  ASSERT_TRUE(SameElements(S1, S2));
+  S1.erase(S1.begin(), S1.end());
+  ASSERT_TRUE(S1.empty());
+}
+
+TEST(BTree, map_backend) {
+  BTreeMap M1{{3, "c"}, {1, "a"}};
+  std::map<int, std::string> M2{{3, "c"}, {1, "a"}};
+  ASSERT_TRUE(M1.insert(2, "b").second);
+  M2.insert({2, "b"});
+  ASSERT_FALSE(M1.insert(2, "x").second);
+  M1.insert_or_assign(3, "C");
+  M2[3] = "C";
+  ASSERT_EQ(M1.at(3), "C");
+  ASSERT_THROW(M1.at(4), std::out_of_range);
+  M1[1] = "A";
+  M2[1] = "A";
+  ASSERT_TRUE(SameElements(M1, M2));
+  ASSERT_TRUE(M1.contains(2));
+  for (int i = 10; i < 2000; i++) {
+    M1.insert(i, std::to_string(i));
+    M2.emplace(i, std::to_string(i));
+  }
+  ASSERT_TRUE(SameElements(M1, M2));
+  ASSERT_EQ(M1.at(1234), "1234");
+  for (int i = 10; i < 2000; i += 2) {
+    auto iter = M1.begin();
+    while (iter->first != i) ++iter;
+    M1.erase(iter);
+    M2.erase(i);
+  }
+  ASSERT_TRUE(SameElements(M1, M2));
+  ASSERT_FALSE(M1.try_emplace(1, "x").second);
+  ASSERT_EQ(M1.at(1), "A");
+  ASSERT_TRUE(M1.find(10) == M1.end());
+  ASSERT_EQ((*M1.find(11)).second, "11");
+}
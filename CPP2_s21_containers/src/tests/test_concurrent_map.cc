@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../btree/s21_btree.h"
+#include "../concurrent_map/s21_concurrent_map.h"
+
+TEST(concurrent_map, basic_operations) {
+  s21::concurrent_map<int, std::string> map(5);
+  ASSERT_EQ(map.shard_count(), 8U);
+  ASSERT_TRUE(map.empty());
+  ASSERT_TRUE(map.insert(1, "one"));
+  ASSERT_FALSE(map.insert(1, "uno"));
+  ASSERT_EQ(map.at(1), "one");
+  ASSERT_FALSE(map.insert_or_assign(1, "uno"));
+  ASSERT_TRUE(map.insert_or_assign(2, "two"));
+  ASSERT_EQ(map.at(1), "uno");
+  ASSERT_TRUE(map.contains(2));
+  ASSERT_FALSE(map.contains(3));
+  ASSERT_THROW(map.at(3), std::out_of_range);
+  ASSERT_EQ(map.size(), 2U);
+  ASSERT_TRUE(map.erase(1));
+  ASSERT_FALSE(map.erase(1));
+  ASSERT_EQ(map.size(), 1U);
+  map.clear();
+  ASSERT_TRUE(map.empty());
+}
+
+TEST(concurrent_map, snapshot_is_ordered) {
+  s21::concurrent_map<int, int, s21::btree<int, std::pair<const int, int>>>
+      map(16);
+  for (int i = 999; i >= 0; i--) map.insert(i * 7 % 1000, i);
+  auto all = map.snapshot();
+  ASSERT_EQ(all.size(), 1000U);
+  for (int i = 0; i < 1000; i++) ASSERT_EQ(all[i].first, i);
+  auto range = map.snapshot(100, 110);
+  ASSERT_EQ(range.size(), 10U);
+  for (int i = 0; i < 10; i++) {
+    ASSERT_EQ(range[i].first, 100 + i);
+    ASSERT_EQ(range[i].second, map.at(100 + i));
+  }
+  ASSERT_TRUE(map.snapshot(5, 5).empty());
+  ASSERT_TRUE(map.snapshot(10, 5).empty());
+}
+
+TEST(concurrent_map, range_snapshot_bounds) {
+  s21::concurrent_map<int, int> map(8);
+  for (int i = 0; i < 200; i += 2) map.insert(i, -i);
+  auto range = map.snapshot(51, 61);
+  ASSERT_EQ(range.size(), 5U);
+  for (int i = 0; i < 5; i++) ASSERT_EQ(range[i].first, 52 + 2 * i);
+  ASSERT_EQ(map.snapshot(-10, 3).size(), 2U);
+  ASSERT_EQ(map.snapshot(190, 1000).size(), 5U);
+  ASSERT_TRUE(map.snapshot(500, 600).empty());
+}
+
+// The writer stores generation g in keys 0, 1, ..., kKeys - 1 in turn, so
+// any consistent snapshot reads g, ..., g, g - 1, ..., g - 1.
+TEST(concurrent_map, snapshot_is_consistent) {
+  constexpr int kKeys = 64;
+  s21::concurrent_map<int, int> map(16);
+  for (int key = 0; key < kKeys; key++) map.insert(key, 0);
+  std::atomic<bool> done(false);
+  std::thread writer([&map, &done] {
+    for (int gen = 1; gen <= 2000; gen++) {
+      for (int key = 0; key < kKeys; key++) map.insert_or_assign(key, gen);
+    }
+    done = true;
+  });
+  std::vector<std::thread> readers;
+  std::atomic<int> broken(0);
+  for (int t = 0; t < 3; t++) {
+    readers.emplace_back([&map, &done, &broken] {
+      while (!done) {
+        auto all = map.snapshot();
+        for (int key = 1; key < kKeys; key++) {
+          int diff = all[0].second - all[key].second;
+          if (all[key - 1].second < all[key].second || diff > 1) broken++;
+        }
+        if (!map.contains(kKeys - 1)) broken++;
+      }
+    });
+  }
+  writer.join();
+  for (std::thread& reader : readers) reader.join();
+  ASSERT_EQ(broken.load(), 0);
+  ASSERT_EQ(map.at(0), 2000);
+}
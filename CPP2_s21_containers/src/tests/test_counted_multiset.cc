@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+
+#include <iterator>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../counted_multiset/s21_counted_multiset.h"
+
+template <typename Key>
+bool CountedEqual(s21::counted_multiset<Key>& S1,
+                  const std::multiset<Key>& S2) {
+  if (S1.size() != S2.size()) return false;
+  auto iter = S1.begin();
+  for (const Key& key : S2) {
+    if (iter == S1.end() || !(*iter == key)) return false;
+    ++iter;
+  }
+  return iter == S1.end();
+}
+
+TEST(CountedMultiset, one_node_per_key) {
+  s21::counted_multiset<int> S1;
+  for (int i = 0; i < 100000; i++) S1.insert(i % 3);
+  ASSERT_EQ(S1.size(), 100000u);
+  ASSERT_EQ(S1.count(0), 33334u);
+  ASSERT_EQ(S1.count(2), 33333u);
+  ASSERT_EQ(S1.count(7), 0u);
+  ASSERT_EQ(*S1.nth(33334), 1);
+  ASSERT_EQ(S1.rank(2), 66667u);
+  ASSERT_EQ(S1.count_range(1, 3), 66666u);
+
+  auto last = S1.nth(S1.size() - 1);
+  ASSERT_EQ(*last, 2);
+  --last;
+  ASSERT_EQ(*last, 2);
+  size_t copies = 0;
+  for (auto iter = S1.lower_bound(1); iter != S1.upper_bound(1); ++iter) {
+    copies++;
+  }
+  ASSERT_EQ(copies, 33333u);
+
+  S1.erase(S1.find(0));
+  ASSERT_EQ(S1.count(0), 33333u);
+  ASSERT_EQ(S1.size(), 99999u);
+}
+
+TEST(CountedMultiset, matches_std_multiset) {
+  std::mt19937 gen(11);
+  std::uniform_int_distribution<int> dist(0, 40);
+  s21::counted_multiset<int> S1;
+  std::multiset<int> S2;
+  for (int i = 0; i < 5000; i++) {
+    int key = dist(gen);
+    if (i % 3 == 2) {
+      auto iter1 = S1.lower_bound(key);
+      auto iter2 = S2.lower_bound(key);
+      ASSERT_EQ(iter1 == S1.end(), iter2 == S2.end());
+      if (iter2 != S2.end()) {
+        S1.erase(iter1);
+        S2.erase(iter2);
+      }
+    } else {
+      auto pair = S1.insert(key);
+      S2.insert(key);
+      ASSERT_EQ(*pair.first, key);
+    }
+  }
+  ASSERT_TRUE(CountedEqual(S1, S2));
+  auto iter2 = S2.begin();
+  for (size_t k = 0; k < S2.size(); k++, ++iter2) {
+    ASSERT_EQ(*S1.nth(k), *iter2);
+    ASSERT_EQ(S1.rank(*iter2), static_cast<size_t>(std::distance(
+                                   S2.begin(), S2.lower_bound(*iter2))));
+  }
+  ASSERT_THROW(S1.nth(S2.size()), std::out_of_range);
+
+  auto erased = S1.erase(S1.nth(10), S1.nth(300));
+  auto first = S2.begin(), last = S2.begin();
+  std::advance(first, 10);
+  std::advance(last, 300);
+  auto after = S2.erase(first, last);
+  ASSERT_EQ(*erased, *after);
+  ASSERT_TRUE(CountedEqual(S1, S2));
+
+  erased = S1.erase(S1.nth(5), S1.end());
+  first = S2.begin();
+  std::advance(first, 5);
+  S2.erase(first, S2.end());
+  ASSERT_TRUE(erased == S1.end());
+  ASSERT_TRUE(CountedEqual(S1, S2));
+}
+
+TEST(CountedMultiset, range_insert_merge_and_copies) {
+  std::vector<std::string> words{"b", "a", "a", "c", "b", "b", "a"};
+  s21::counted_multiset<std::string> S1(words.begin(), words.end());
+  std::multiset<std::string> S2(words.begin(), words.end());
+  ASSERT_TRUE(CountedEqual(S1, S2));
+
+  s21::counted_multiset<std::string> S3{"a", "d", "d"};
+  S1.merge(S3);
+  S2.insert({"a", "d", "d"});
+  ASSERT_TRUE(S3.empty());
+  ASSERT_TRUE(CountedEqual(S1, S2));
+
+  s21::counted_multiset<std::string> S4(S1);
+  S4.insert_many("e", "a");
+  S2.insert({"e", "a"});
+  ASSERT_TRUE(CountedEqual(S4, S2));
+  ASSERT_EQ(S1.size(), S2.size() - 2);
+
+  s21::counted_multiset<std::string> S5(std::move(S4));
+  ASSERT_TRUE(CountedEqual(S5, S2));
+  S5.swap(S1);
+  ASSERT_EQ(S5.count("e"), 0u);
+  S5.clear();
+  ASSERT_TRUE(S5.empty());
+  ASSERT_TRUE(S5.begin() == S5.end());
+}
+
+TEST(CountedMultiset, set_algebra) {
+  s21::counted_multiset<int> A{1, 1, 1, 2, 3, 3};
+  s21::counted_multiset<int> B{1, 2, 2, 4};
+  std::multiset<int> united{1, 1, 1, 2, 2, 3, 3, 4};
+  std::multiset<int> common{1, 2};
+  std::multiset<int> rest{1, 1, 3, 3};
+
+  auto S1 = set_union(A, B);
+  ASSERT_TRUE(CountedEqual(S1, united));
+  auto S2 = set_intersection(A, B);
+  ASSERT_TRUE(CountedEqual(S2, common));
+  auto S3 = set_difference(A, B);
+  ASSERT_TRUE(CountedEqual(S3, rest));
+  auto S4 = set_union(std::move(A), std::move(B));
+  ASSERT_TRUE(CountedEqual(S4, united));
+  ASSERT_TRUE(A.empty());
+  ASSERT_TRUE(B.empty());
+}
@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../flat_map/s21_flat_map.h"
+#include "../flat_set/s21_flat_set.h"
+
+template <typename Flat, typename Std>
+bool FlatEqual(Flat& flat, const Std& expected) {
+  if (flat.size() != expected.size()) return false;
+  auto iter = flat.begin();
+  for (const auto& value : expected) {
+    if (iter == flat.end() || !(*iter == value)) return false;
+    ++iter;
+  }
+  return iter == flat.end();
+}
+
+TEST(FlatTree, lower_and_upper_bound) {
+  std::vector<int> keys{1, 3, 3, 3, 5, 8, 8, 13};
+  s21::flat_tree<int, int> T(keys.begin(), keys.end());
+  for (int key = 0; key < 15; key++) {
+    bool present = std::binary_search(keys.begin(), keys.end(), key);
+    auto found = T.find_key(key);
+    ASSERT_EQ(found != nullptr, present);
+    if (present) {
+      ASSERT_EQ(*found, key);
+      auto prev = found;
+      ASSERT_TRUE(--prev == nullptr || *prev < key);
+    }
+  }
+  s21::flat_tree<int, int> empty;
+  ASSERT_TRUE(empty.find_key(1) == nullptr);
+  ASSERT_TRUE(empty.begin() == empty.end());
+  ASSERT_THROW(*empty.begin(), std::runtime_error);
+}
+
+TEST(FlatSet, random_against_set) {
+  std::mt19937 gen(11);
+  std::uniform_int_distribution<int> key(0, 1000);
+  s21::flat_set<int> S1;
+  std::set<int> S2;
+  for (int i = 0; i < 5000; i++) {
+    int k = key(gen);
+    if (gen() % 3) {
+      ASSERT_EQ(S1.insert(k).second, S2.insert(k).second);
+    } else if (S2.erase(k)) {
+      auto iter = S1.begin();
+      while (*iter != k) ++iter;
+      S1.erase(iter);
+    }
+    ASSERT_EQ(S1.contains(k), S2.count(k) == 1);
+  }
+  ASSERT_TRUE(FlatEqual(S1, S2));
+  std::vector<int> backwards;
+  auto iter = S1.begin();
+  for (size_t i = 1; i < S1.size(); i++) ++iter;
+  for (; iter != nullptr; --iter) backwards.push_back(*iter);
+  ASSERT_TRUE(std::equal(backwards.begin(), backwards.end(), S2.rbegin()));
+}
+
+TEST(FlatSet, batch_insert) {
+  std::vector<int> batch;
+  for (int i = 0; i < 3000; i++) batch.push_back((i * 7919) % 2000);
+  s21::flat_set<int> S1{5, 2001, 3000};
+  std::set<int> S2{5, 2001, 3000};
+  S1.insert(batch.begin(), batch.end());
+  S2.insert(batch.begin(), batch.end());
+  ASSERT_TRUE(FlatEqual(S1, S2));
+  s21::flat_set<int> S3(batch.begin(), batch.end());
+  ASSERT_EQ(S3.size(), 2000U);
+  S3.insert(batch.begin(), batch.begin());
+  ASSERT_EQ(S3.size(), 2000U);
+}
+
+TEST(FlatSet, merge_and_set_algebra) {
+  s21::flat_set<int> S1{1, 2, 3, 4};
+  s21::flat_set<int> S2{3, 4, 5};
+  s21::flat_set<int> U = set_union(S1, S2);
+  s21::flat_set<int> I = set_intersection(S1, S2);
+  s21::flat_set<int> D = set_difference(S1, S2);
+  ASSERT_TRUE(FlatEqual(U, std::set<int>{1, 2, 3, 4, 5}));
+  ASSERT_TRUE(FlatEqual(I, std::set<int>{3, 4}));
+  ASSERT_TRUE(FlatEqual(D, std::set<int>{1, 2}));
+  s21::flat_set<int> copy(S1);
+  s21::flat_set<int> moved = set_union(std::move(copy), s21::flat_set<int>(S2));
+  ASSERT_TRUE(copy.empty());
+  ASSERT_TRUE(FlatEqual(moved, std::set<int>{1, 2, 3, 4, 5}));
+  S1.merge(S2);
+  ASSERT_TRUE(FlatEqual(S1, std::set<int>{1, 2, 3, 4, 5}));
+  ASSERT_TRUE(FlatEqual(S2, std::set<int>{3, 4}));
+  S2 = S1;
+  S1.clear();
+  ASSERT_TRUE(S1.empty());
+  ASSERT_EQ(S2.size(), 5U);
+}
+
+TEST(FlatSet, multiset) {
+  s21::flat_multiset<int> S1{3, 1, 3};
+  std::multiset<int> S2{3, 1, 3};
+  S1.insert(3);
+  S2.insert(3);
+  S1.insert_many(0, 1);
+  S2.insert({0, 1});
+  ASSERT_TRUE(FlatEqual(S1, S2));
+  s21::flat_multiset<int> S3{1, 9};
+  S1.merge(S3);
+  S2.insert({1, 9});
+  ASSERT_TRUE(FlatEqual(S1, S2));
+  ASSERT_TRUE(S3.empty());
+}
+
+TEST(FlatSet, order_statistics) {
+  s21::flat_multiset<int> S1{4, 1, 4, 9, 2};
+  ASSERT_EQ(*S1.nth(0), 1);
+  ASSERT_EQ(*S1.nth(3), 4);
+  ASSERT_EQ(S1.rank(4), 2U);
+  ASSERT_EQ(S1.count_range(2, 9), 3U);
+  ASSERT_THROW(S1.nth(5), std::out_of_range);
+  ASSERT_EQ(S1.count(4), 2U);
+  auto range = S1.equal_range(4);
+  ASSERT_EQ(*range.second, 9);
+  ASSERT_EQ(*S1.erase(range.first, range.second), 9);
+  ASSERT_TRUE(S1.upper_bound(9) == nullptr);
+  ASSERT_TRUE(S1.erase(S1.lower_bound(2), S1.end()) == nullptr);
+  ASSERT_EQ(S1.size(), 1U);
+}
+
+TEST(FlatMap, interface) {
+  s21::flat_map<std::string, int> M1{{"b", 2}, {"a", 1}, {"b", 3}};
+  std::map<std::string, int> M2{{"b", 2}, {"a", 1}};
+  ASSERT_EQ(M1.size(), 2U);
+  ASSERT_EQ(M1.at("b"), 2);
+  ASSERT_THROW(M1.at("z"), std::out_of_range);
+  ASSERT_TRUE(M1.insert("c", 3).second);
+  M2["c"] = 3;
+  ASSERT_FALSE(M1.insert({"c", 4}).second);
+  M1.insert_or_assign("a", 10);
+  M2["a"] = 10;
+  M1["b"] = 20;
+  M2["b"] = 20;
+  ASSERT_TRUE(M1.contains("c"));
+  ASSERT_FALSE(M1.contains("d"));
+  auto iter = M1.begin();
+  for (const auto& item : M2) {
+    ASSERT_EQ(iter->first, item.first);
+    ASSERT_EQ(iter->second, item.second);
+    ++iter;
+  }
+  ASSERT_TRUE(iter == M1.end());
+
+  std::vector<std::pair<const std::string, int>> batch;
+  for (int i = 0; i < 500; i++) batch.emplace_back(std::to_string(i % 300), i);
+  M1.insert(batch.begin(), batch.end());
+  M2.insert(batch.begin(), batch.end());
+  ASSERT_EQ(M1.size(), M2.size());
+  for (const auto& item : M2) ASSERT_EQ(M1.at(item.first), item.second);
+  s21::flat_map<std::string, int> M3{{"a", 0}, {"zz", 1}};
+  M1.merge(M3);
+  ASSERT_EQ(M1.at("zz"), 1);
+  ASSERT_EQ(M1.at("a"), 10);
+  ASSERT_EQ(M3.size(), 1U);
+}
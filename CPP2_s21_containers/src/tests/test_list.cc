@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include <list>
+#include <vector>
 
 #include "../list/s21_list.h"
 
@@ -618,6 +619,36 @@ TEST(list, clear_string) {
   ASSERT_EQ(list.size(), std_list.size());
 }
 
+struct Tracked {
+  static std::vector<int> destroyed;
+  int id = 0;
+  Tracked() = default;
+  Tracked(int value) : id(value) {}
+  Tracked(const Tracked&) = default;
+  Tracked& operator=(const Tracked&) = default;
+  ~Tracked() { destroyed.push_back(id); }
+};
+std::vector<int> Tracked::destroyed;
+
+// pop_back() destroys from the back; clear() walks the list once from the
+// front and then frees the slabs, so the values go in list order.
+TEST(list, clear_destroys_in_place) {
+  s21::list<Tracked> list;
+  for (int i = 1; i <= 5; i++) list.push_back(Tracked(i));
+  Tracked::destroyed.clear();
+  list.clear();
+  // Storing the size in the end node may destroy one more temporary.
+  Tracked::destroyed.resize(5);
+  ASSERT_EQ(Tracked::destroyed, (std::vector<int>{1, 2, 3, 4, 5}));
+  ASSERT_TRUE(list.empty());
+  ASSERT_TRUE(list.begin() == list.end());
+  list.push_back(Tracked(6));
+  list.push_front(Tracked(7));
+  ASSERT_EQ(list.size(), 2u);
+  ASSERT_EQ(list.front().id, 7);
+  ASSERT_EQ(list.back().id, 6);
+}
+
 TEST(list, insert_int_1) {
   s21::list<int> list1;
   std::list<int> std_list1;
@@ -951,6 +982,74 @@ TEST(list, merge_string_1) {
   }
 }
 
+TEST(list, merge_relinks_nodes) {
+  s21::list<int> list1{1, 3, 5, 7};
+  s21::list<int> list1_copy;
+  int *seven = &*(--list1.end());
+  {
+    s21::list<int> list2{0, 3, 4, 8, 9};
+    int *eight = &*(--(--list2.end()));
+    list1.merge(list2);
+    ASSERT_EQ(list2.size(), 0U);
+    ASSERT_TRUE(list2.begin() == list2.end());
+    list2.push_back(42);
+    ASSERT_EQ(list2.front(), 42);
+    ASSERT_EQ(&*(--(--list1.end())), eight);
+  }
+  std::list<int> expected{0, 1, 3, 3, 4, 5, 7, 8, 9};
+  ASSERT_EQ(list1.size(), expected.size());
+  s21::list<int>::iterator iter_s21 = list1.begin();
+  for (int value : expected) {
+    ASSERT_EQ(*iter_s21, value);
+    iter_s21++;
+  }
+  ASSERT_EQ(&*(++(++(++(++(++(++list1.begin())))))), seven);
+  list1_copy.merge(list1);
+  ASSERT_EQ(list1_copy.size(), expected.size());
+  ASSERT_EQ(list1_copy.front(), 0);
+  ASSERT_EQ(list1_copy.back(), 9);
+}
+
+TEST(list, merge_comparator) {
+  s21::list<int> list1{9, 5, 1};
+  s21::list<int> list2{8, 5, 2, 0};
+  list1.merge(list2, std::greater<int>());
+  std::list<int> expected{9, 8, 5, 5, 2, 1, 0};
+  s21::list<int>::iterator iter_s21 = list1.begin();
+  for (int value : expected) {
+    ASSERT_EQ(*iter_s21, value);
+    iter_s21++;
+  }
+  ASSERT_EQ(list1.back(), 0);
+}
+
+TEST(list, splice_middle_and_end) {
+  s21::list<std::string> list1{"a", "d"};
+  s21::list<std::string> list2{"b", "c"};
+  s21::list<std::string> list3{"e"};
+  std::string *b = &*list2.begin();
+  list1.splice(s21::list<std::string>::const_iterator((++list1.begin()).ptr_),
+               list2);
+  list1.splice(list1.cend(), list3);
+  list2.push_front("x");
+  ASSERT_EQ(list2.size(), 1U);
+  ASSERT_EQ(list3.size(), 0U);
+  std::list<std::string> expected{"a", "b", "c", "d", "e"};
+  ASSERT_EQ(list1.size(), expected.size());
+  s21::list<std::string>::iterator iter_s21 = list1.begin();
+  for (const std::string &value : expected) {
+    ASSERT_EQ(*iter_s21, value);
+    iter_s21++;
+  }
+  ASSERT_EQ(&*(++list1.begin()), b);
+  ASSERT_EQ(list1.back(), "e");
+  s21::list<std::string> empty;
+  empty.splice(empty.cbegin(), list1);
+  ASSERT_EQ(empty.size(), 5U);
+  ASSERT_EQ(empty.front(), "a");
+  ASSERT_EQ(empty.back(), "e");
+}
+
 TEST(list, splice_int) {
   s21::list<int> list1{100, 700, 100, 400};
   s21::list<int> list2{111, 722, 133, 444};
@@ -1084,6 +1183,53 @@ TEST(list, sort_string) {
   }
 }
 
+TEST(list, sort_comparator) {
+  s21::list<int> list1{5, -3, 8, 0, 8, -7, 2};
+  std::list<int> std_list1{5, -3, 8, 0, 8, -7, 2};
+  list1.sort(std::greater<int>());
+  std_list1.sort(std::greater<int>());
+  ASSERT_EQ(list1.size(), std_list1.size());
+  s21::list<int>::iterator iter_s21 = list1.begin();
+  std::list<int>::iterator iter_std = std_list1.begin();
+  for (size_t i = 0; i < std_list1.size(); i++, iter_s21++, iter_std++) {
+    ASSERT_EQ(*iter_s21, *iter_std);
+  }
+  ASSERT_EQ(list1.back(), -7);
+  ASSERT_EQ(*(--list1.end()), -7);
+}
+
+TEST(list, sort_stable_relinks_nodes) {
+  s21::list<int> list1{31, 12, 22, 11, 32, 21};
+  int *first_twelve = &*(++list1.begin());
+  list1.sort([](int a, int b) { return a / 10 < b / 10; });
+  std::list<int> expected{12, 11, 22, 21, 31, 32};
+  s21::list<int>::iterator iter_s21 = list1.begin();
+  for (int value : expected) {
+    ASSERT_EQ(*iter_s21, value);
+    iter_s21++;
+  }
+  ASSERT_EQ(&*list1.begin(), first_twelve);
+}
+
+TEST(list, sort_large) {
+  s21::list<int> list1;
+  std::list<int> std_list1;
+  unsigned int seed = 21;
+  for (int i = 0; i < 200000; i++) {
+    seed = seed * 1103515245 + 12345;
+    list1.push_back(static_cast<int>(seed >> 8));
+    std_list1.push_back(static_cast<int>(seed >> 8));
+  }
+  list1.sort();
+  std_list1.sort();
+  s21::list<int>::iterator iter_s21 = list1.begin();
+  for (int value : std_list1) {
+    ASSERT_EQ(*iter_s21, value);
+    ++iter_s21;
+  }
+  ASSERT_TRUE(iter_s21 == list1.end());
+}
+
 TEST(list, class_list_int) {
   s21::list<int> list1;
   s21::list<s21::list<int>> list_class;
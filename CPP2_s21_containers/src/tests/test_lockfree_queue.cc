@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../lockfree_queue/s21_lockfree_queue.h"
+
+TEST(mpmc_queue, single_thread) {
+  s21::mpmc_queue<std::string> queue(5);
+  ASSERT_EQ(queue.capacity(), 8U);
+  ASSERT_TRUE(queue.empty());
+  std::string out;
+  ASSERT_FALSE(queue.try_pop(out));
+  for (int i = 0; i < 8; i++) ASSERT_TRUE(queue.try_push(std::to_string(i)));
+  ASSERT_FALSE(queue.try_emplace(3, 'x'));
+  ASSERT_EQ(queue.size(), 8U);
+  for (int lap = 0; lap < 3; lap++) {
+    for (int i = 0; i < 8; i++) {
+      ASSERT_TRUE(queue.try_pop(out));
+      ASSERT_EQ(out, std::to_string(i));
+      ASSERT_TRUE(queue.try_push(std::to_string(i)));
+    }
+  }
+  queue.pop(out);
+  ASSERT_EQ(out, "0");
+  queue.emplace_back("a");
+  ASSERT_EQ(queue.size(), 8U);
+  ASSERT_THROW(s21::mpmc_queue<std::string>(queue.max_size() + 1),
+               std::length_error);
+}
+
+TEST(mpmc_queue, batches) {
+  s21::mpmc_queue<int> queue(8);
+  std::vector<int> items{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  ASSERT_EQ(queue.push_many(items.begin(), items.end()), 8U);
+  std::vector<int> out;
+  ASSERT_EQ(queue.pop_many(std::back_inserter(out), 3), 3U);
+  ASSERT_EQ(queue.push_many(items.begin() + 8, items.end()), 2U);
+  ASSERT_EQ(queue.pop_many(std::back_inserter(out), 100), 7U);
+  ASSERT_EQ(out, items);
+  ASSERT_EQ(queue.pop_many(std::back_inserter(out), 100), 0U);
+}
+
+TEST(mpmc_queue, many_threads) {
+  constexpr int kThreads = 4;
+  constexpr int kItems = 20000;
+  s21::mpmc_queue<int> queue(64);
+  std::atomic<long long> sum(0);
+  std::atomic<int> popped(0);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; t++) {
+    threads.emplace_back([&queue] {
+      for (int i = 0; i < kItems; i += 4) {
+        int batch[4] = {i, i + 1, i + 2, i + 3};
+        int *first = batch;
+        while (first != batch + 4) {
+          first += queue.push_many(first, batch + 4);
+        }
+      }
+    });
+    threads.emplace_back([&queue, &sum, &popped] {
+      int value;
+      while (popped.load() < kThreads * kItems) {
+        if (queue.try_pop(value)) {
+          sum += value;
+          popped++;
+        }
+      }
+    });
+  }
+  for (std::thread &thread : threads) thread.join();
+  ASSERT_EQ(sum.load(), kThreads * (long long)kItems * (kItems - 1) / 2);
+  ASSERT_TRUE(queue.empty());
+}
+
+TEST(spsc_queue, single_thread) {
+  s21::spsc_queue<std::string> queue(4);
+  ASSERT_EQ(queue.capacity(), 4U);
+  std::vector<std::string> items{"a", "b", "c", "d", "e"};
+  ASSERT_EQ(queue.push_many(items.begin(), items.end()), 4U);
+  ASSERT_FALSE(queue.try_push("e"));
+  std::string out;
+  ASSERT_TRUE(queue.try_pop(out));
+  ASSERT_EQ(out, "a");
+  queue.emplace_back("e");
+  std::vector<std::string> rest;
+  ASSERT_EQ(queue.pop_many(std::back_inserter(rest), 10), 4U);
+  ASSERT_EQ(rest, std::vector<std::string>(items.begin() + 1, items.end()));
+  ASSERT_TRUE(queue.empty());
+  queue.push("left in the queue");
+}
+
+TEST(spsc_queue, keeps_order_across_threads) {
+  constexpr int kItems = 100000;
+  s21::spsc_queue<int> queue(128);
+  std::thread producer([&queue] {
+    for (int i = 0; i < kItems; i++) queue.push(i);
+  });
+  bool ordered = true;
+  int next = 0;
+  while (next < kItems) {
+    int batch[16];
+    size_t n = queue.pop_many(batch, 16);
+    for (size_t i = 0; i < n; i++) ordered = ordered && batch[i] == next++;
+  }
+  producer.join();
+  ASSERT_TRUE(ordered);
+  ASSERT_TRUE(queue.empty());
+}
@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 
+#include <functional>
 #include <map>
+#include <string>
+#include <string_view>
+#include <vector>
 
 #include "../map/s21_map.h"
 
@@ -318,3 +322,102 @@ TEST(Map, insert_many) {
   }
   ASSERT_EQ(M1.size(), M2.size());
 }
+
+TEST(Map, range_constructor) {
+  std::vector<std::pair<const int, char>> items;
+  for (int i = 0; i < 1000; i++) {
+    items.push_back({i, static_cast<char>('a' + i % 26)});
+  }
+  items.push_back({500, 'z'});
+  s21::Map<int, char> M1(items.begin(), items.end());
+  std::map<int, char> M2(items.begin(), items.end());
+  ASSERT_EQ(MapsEqual(M1, M2), true);
+  ASSERT_EQ(M1.at(500), M2.at(500));
+  std::vector<std::pair<const int, char>> more{
+      {2000, 'x'}, {-1, 'y'}, {7, 'q'}};
+  M1.insert(more.begin(), more.end());
+  M2.insert(more.begin(), more.end());
+  ASSERT_EQ(MapsEqual(M1, M2), true);
+  M1.insert(1, 'b');
+  ASSERT_EQ(M1.at(1), 'b');
+}
+
+TEST(Map, merge_compares_keys) {
+  s21::Map<int, std::string> M1{{1, "a"}, {3, "c"}};
+  s21::Map<int, std::string> M2{{1, "x"}, {2, "b"}};
+  M1.merge(M2);
+  ASSERT_EQ(M1.size(), 3u);
+  ASSERT_EQ(M1.at(1), "a");
+  ASSERT_EQ(M1.at(2), "b");
+  ASSERT_EQ(M2.size(), 1u);
+  ASSERT_EQ((*M2.begin()).second, "x");
+}
+
+namespace {
+
+struct Counted {
+  static int constructed;
+  int value;
+  Counted(int v = 0) : value(v) { constructed++; }
+  Counted(const Counted& other) : value(other.value) { constructed++; }
+  Counted& operator=(const Counted& other) = default;
+};
+
+int Counted::constructed = 0;
+
+}  // namespace
+
+TEST(Map, try_emplace_builds_only_on_insert) {
+  s21::Map<int, Counted> M1;
+  Counted::constructed = 0;
+  ASSERT_TRUE(M1.try_emplace(1, 10).second);
+  ASSERT_EQ(Counted::constructed, 1);
+  ASSERT_FALSE(M1.try_emplace(1, 20).second);
+  ASSERT_EQ(M1.at(1).value, 10);
+  ASSERT_EQ(M1[2].value, 0);
+  ASSERT_EQ(M1[1].value, 10);
+  ASSERT_EQ(Counted::constructed, 2);
+  ASSERT_FALSE(M1.insert_or_assign(2, Counted(5)).second);
+  ASSERT_EQ(M1.at(2).value, 5);
+  ASSERT_EQ(M1.size(), 2u);
+}
+
+TEST(Map, heterogeneous_lookup) {
+  s21::Map<std::string, int,
+           tree<std::string, std::pair<const std::string, int>>, std::less<>>
+      M1{{"apple", 1}, {"pear", 2}};
+  std::string_view key("pear");
+  ASSERT_EQ(M1.at(key), 2);
+  ASSERT_TRUE(M1.contains(key));
+  ASSERT_FALSE(M1.contains(std::string_view("plum")));
+  ASSERT_EQ((*M1.find("apple")).second, 1);
+  ASSERT_TRUE(M1.find("plum") == M1.end());
+  ASSERT_THROW(M1.at("plum"), std::out_of_range);
+  M1["plum"] = 3;
+  ASSERT_EQ(M1.at(std::string_view("plum")), 3);
+}
+
+TEST(Map, lookup_converts_without_transparent_compare) {
+  s21::Map<size_t, int> M1{{1, 10}};
+  ASSERT_TRUE(M1.contains(1));
+  ASSERT_EQ(M1.at(1), 10);
+  s21::Map<int, int> M2{{2, 5}};
+  double key = 2.5;
+  ASSERT_TRUE(M2.contains(key));
+  ASSERT_EQ((*M2.find(key)).second, 5);
+}
+
+TEST(Map, bounds) {
+  s21::Map<int, char> M1{{1, 'a'}, {5, 'e'}, {9, 'i'}};
+  ASSERT_EQ((*M1.lower_bound(5)).second, 'e');
+  ASSERT_EQ((*M1.upper_bound(5)).second, 'i');
+  ASSERT_EQ((*M1.lower_bound(2)).first, 5);
+  ASSERT_TRUE(M1.lower_bound(10) == nullptr);
+  ASSERT_EQ(M1.count(9), 1u);
+  ASSERT_EQ(M1.count(4), 0u);
+  auto range = M1.equal_range(1);
+  ASSERT_EQ((*range.first).first, 1);
+  ASSERT_EQ((*range.second).first, 5);
+  M1.erase(M1.lower_bound(2), M1.end());
+  ASSERT_EQ(M1.size(), 1u);
+}
@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <iterator>
+#include <random>
 #include <set>
+#include <vector>
 
 #include "../multiset/s21_multiset.h"
 
@@ -235,3 +239,132 @@ TEST(Multiset, max_size) {
   std::multiset<int> S2 = {1, 2, 3};
   EXPECT_NEAR(S1.max_size() / S2.max_size(), 1, 1);
 }
+
+TEST(Multiset, range_constructor) {
+  std::vector<int> keys{1, 1, 2, 3, 3, 3, 8};
+  s21::Multiset<int> S1(keys.begin(), keys.end());
+  std::multiset<int> S2(keys.begin(), keys.end());
+  ASSERT_EQ(S1.size(), S2.size());
+  std::vector<int> more{3, 0, 9, 1};
+  S1.insert(more.begin(), more.end());
+  S2.insert(more.begin(), more.end());
+  ASSERT_EQ(S1.size(), S2.size());
+  s21::Multiset<int>::iterator iter1 = S1.begin();
+  for (auto iter2 = S2.begin(); iter2 != S2.end(); ++iter1, ++iter2) {
+    ASSERT_EQ(*iter1, *iter2);
+  }
+}
+
+TEST(Multiset, merge_keeps_equal_keys_in_order) {
+  s21::Multiset<int> S1{5, 1, 3, 3};
+  s21::Multiset<int> S2{3, 0, 5, 9};
+  std::multiset<int> S3{5, 1, 3, 3};
+  std::multiset<int> S4{3, 0, 5, 9};
+  S1.merge(S2);
+  S3.merge(S4);
+  ASSERT_TRUE(MultisetsEqual(S1, S3));
+  ASSERT_TRUE(S2.empty());
+  S1.insert(4);
+  S3.insert(4);
+  ASSERT_TRUE(MultisetsEqual(S1, S3));
+}
+
+TEST(Multiset, set_algebra_counts) {
+  std::vector<int> a{1, 1, 1, 2, 3, 3, 7};
+  std::vector<int> b{1, 3, 3, 3, 4, 7, 7};
+  s21::Multiset<int> S1(a.begin(), a.end()), S2(b.begin(), b.end());
+  std::multiset<int> U, I, D;
+  std::set_union(a.begin(), a.end(), b.begin(), b.end(),
+                 std::inserter(U, U.end()));
+  std::set_intersection(a.begin(), a.end(), b.begin(), b.end(),
+                        std::inserter(I, I.end()));
+  std::set_difference(a.begin(), a.end(), b.begin(), b.end(),
+                      std::inserter(D, D.end()));
+  ASSERT_TRUE(MultisetsEqual(set_union(S1, S2), U));
+  ASSERT_TRUE(MultisetsEqual(set_intersection(S1, S2), I));
+  ASSERT_TRUE(MultisetsEqual(set_difference(S1, S2), D));
+  ASSERT_EQ(S1.size(), a.size());
+  ASSERT_TRUE(MultisetsEqual(set_union(std::move(S1), std::move(S2)), U));
+  ASSERT_TRUE(S1.empty());
+  ASSERT_TRUE(S2.empty());
+}
+
+// Checks nth() and rank() of every position against the sorted keys.
+bool OrderStatisticsMatch(const s21::Multiset<int>& S1,
+                          const std::multiset<int>& S2) {
+  std::vector<int> keys(S2.begin(), S2.end());
+  for (size_t k = 0; k < keys.size(); k++) {
+    if (*S1.nth(k) != keys[k]) return false;
+    size_t less = std::lower_bound(keys.begin(), keys.end(), keys[k]) -
+                  keys.begin();
+    if (S1.rank(keys[k]) != less) return false;
+  }
+  return true;
+}
+
+TEST(Multiset, order_statistics) {
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<int> dist(0, 200);
+  s21::Multiset<int> S1;
+  std::multiset<int> S2;
+  for (int i = 0; i < 2000; i++) {
+    int key = dist(gen);
+    if (i % 3 == 2) {
+      auto iter1 = S1.begin();
+      while (iter1 != nullptr && *iter1 < key) ++iter1;
+      auto iter2 = S2.lower_bound(key);
+      if (iter1 != nullptr && iter2 != S2.end()) {
+        S1.erase(iter1);
+        S2.erase(iter2);
+      }
+    } else {
+      S1.insert(key);
+      S2.insert(key);
+    }
+  }
+  ASSERT_TRUE(OrderStatisticsMatch(S1, S2));
+  ASSERT_EQ(S1.count_range(50, 100),
+            static_cast<size_t>(std::distance(S2.lower_bound(50),
+                                              S2.lower_bound(100))));
+  ASSERT_EQ(S1.count_range(100, 50), 0u);
+  ASSERT_EQ(S1.rank(-1), 0u);
+  ASSERT_EQ(S1.rank(1000), S2.size());
+  ASSERT_THROW(S1.nth(S2.size()), std::out_of_range);
+
+  std::vector<int> more{5, 500, -5, 100, 100};
+  S1.insert(more.begin(), more.end());
+  S2.insert(more.begin(), more.end());
+  s21::Multiset<int> S3{1, 2, 3};
+  S1.merge(S3);
+  S2.insert({1, 2, 3});
+  s21::Multiset<int> S4(S1);
+  ASSERT_TRUE(OrderStatisticsMatch(S4, S2));
+}
+
+TEST(Multiset, equal_range_count_and_range_erase) {
+  s21::Multiset<int> S1;
+  std::multiset<int> S2;
+  for (int i = 0; i < 1000; i++) {
+    S1.insert(i % 50);
+    S2.insert(i % 50);
+  }
+  ASSERT_EQ(S1.count(7), 20u);
+  ASSERT_EQ(S1.count(50), 0u);
+  auto range = S1.equal_range(7);
+  size_t n = 0;
+  for (auto iter = range.first; iter != range.second; ++iter, n++) {
+    ASSERT_EQ(*iter, 7);
+  }
+  ASSERT_EQ(n, 20u);
+  ASSERT_EQ(*range.second, 8);
+  ASSERT_TRUE(S1.upper_bound(49) == nullptr);
+
+  auto next = S1.erase(range.first, range.second);
+  S2.erase(7);
+  ASSERT_EQ(*next, 8);
+  ASSERT_EQ(S1.count(7), 0u);
+  ASSERT_TRUE(MultisetsEqual(S1, S2));
+  S1.erase(S1.lower_bound(40), S1.end());
+  S2.erase(S2.lower_bound(40), S2.end());
+  ASSERT_TRUE(MultisetsEqual(S1, S2));
+}
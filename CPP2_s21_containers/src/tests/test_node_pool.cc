@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "../pool/s21_node_pool.h"
+#include "../s21_containers.h"
+
+struct CountedNode {
+  static int alive;
+  std::string data;
+  explicit CountedNode(const std::string& value) : data(value) { alive++; }
+  ~CountedNode() { alive--; }
+};
+
+int CountedNode::alive = 0;
+
+TEST(NodePool, create_destroy_reuses_slot) {
+  s21::NodePool<CountedNode> pool;
+  CountedNode* first = pool.create("first");
+  CountedNode* second = pool.create("second");
+  ASSERT_EQ(CountedNode::alive, 2);
+  ASSERT_EQ(first->data, "first");
+  pool.destroy(first);
+  ASSERT_EQ(CountedNode::alive, 1);
+  CountedNode* third = pool.create("third");
+  ASSERT_EQ(third, first);
+  pool.destroy(second);
+  pool.destroy(third);
+  ASSERT_EQ(CountedNode::alive, 0);
+}
+
+TEST(NodePool, many_slabs) {
+  s21::NodePool<CountedNode> pool;
+  CountedNode* nodes[10000];
+  for (int i = 0; i < 10000; i++) nodes[i] = pool.create(std::to_string(i));
+  for (int i = 0; i < 10000; i++) {
+    ASSERT_EQ(nodes[i]->data, std::to_string(i));
+  }
+  for (int i = 0; i < 10000; i += 2) pool.destroy(nodes[i]);
+  ASSERT_EQ(CountedNode::alive, 5000);
+  for (int i = 1; i < 10000; i += 2) pool.destroy(nodes[i]);
+  ASSERT_EQ(CountedNode::alive, 0);
+  pool.release();
+}
+
+TEST(NodePool, adopt_keeps_nodes) {
+  s21::NodePool<CountedNode> pool_1;
+  s21::NodePool<CountedNode> pool_2;
+  CountedNode* a = pool_1.create("a");
+  CountedNode* b = pool_2.create("b");
+  CountedNode* c = pool_2.create("c");
+  pool_2.destroy(c);
+  pool_1.adopt(pool_2);
+  ASSERT_EQ(b->data, "b");
+  CountedNode* d = pool_2.create("d");
+  pool_2.destroy(d);
+  for (int i = 0; i < 100; i++) pool_1.destroy(pool_1.create("x"));
+  ASSERT_EQ(a->data, "a");
+  ASSERT_EQ(b->data, "b");
+  pool_1.destroy(a);
+  pool_1.destroy(b);
+  ASSERT_EQ(CountedNode::alive, 0);
+}
+
+TEST(NodePool, containers_reuse_after_clear) {
+  s21::list<int> L;
+  s21::Set<int> S;
+  for (int round = 0; round < 3; round++) {
+    for (int i = 0; i < 1000; i++) {
+      L.push_back(i);
+      S.insert(i);
+    }
+    ASSERT_EQ(L.size(), 1000U);
+    ASSERT_EQ(S.size(), 1000U);
+    L.clear();
+    S.clear();
+    ASSERT_EQ(L.size(), 0U);
+    ASSERT_EQ(S.size(), 0U);
+  }
+  s21::queue<std::string> Q{"a", "b"};
+  s21::queue<std::string> Q2(std::move(Q));
+  Q2.push("c");
+  ASSERT_EQ(Q2.front(), "a");
+  ASSERT_EQ(Q2.back(), "c");
+  s21::stack<std::string> St{"a", "b"};
+  s21::stack<std::string> St2;
+  St2 = std::move(St);
+  St2.push("c");
+  ASSERT_EQ(St2.top(), "c");
+  ASSERT_EQ(St2.size(), 3U);
+}
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <string>
+#include <utility>
+
+#include "../queue/s21_queue.h"
+#include "../ring_buffer/s21_ring_buffer.h"
+#include "../stack/s21_stack.h"
+
+template <typename T>
+bool SameElements(const s21::ring_buffer<T>& buffer,
+                  const std::deque<T>& expected) {
+  if (buffer.size() != expected.size()) return false;
+  for (size_t i = 0; i < expected.size(); i++) {
+    if (!(buffer[i] == expected[i])) return false;
+  }
+  return true;
+}
+
+TEST(ring_buffer, wraps_and_grows) {
+  s21::ring_buffer<int> buffer;
+  std::deque<int> expected;
+  ASSERT_TRUE(buffer.empty());
+  for (int i = 0; i < 1000; i++) {
+    if (i % 3 == 0) {
+      buffer.push_front(i);
+      expected.push_front(i);
+    } else {
+      buffer.push_back(i);
+      expected.push_back(i);
+    }
+    if (i % 7 == 0 && !expected.empty()) {
+      buffer.pop_front();
+      expected.pop_front();
+    }
+    if (i % 11 == 0 && !expected.empty()) {
+      buffer.pop_back();
+      expected.pop_back();
+    }
+  }
+  ASSERT_TRUE(SameElements(buffer, expected));
+  size_t capacity = buffer.capacity();
+  ASSERT_EQ(capacity & (capacity - 1), 0U);
+  ASSERT_GE(capacity, buffer.size());
+}
+
+TEST(ring_buffer, steady_state_keeps_storage) {
+  s21::ring_buffer<std::string> buffer;
+  for (int i = 0; i < 8; i++) buffer.push_back(std::to_string(i));
+  const std::string* data = &buffer.front();
+  size_t capacity = buffer.capacity();
+  for (int i = 8; i < 1000; i++) {
+    buffer.pop_front();
+    buffer.push_back(std::to_string(i));
+  }
+  ASSERT_EQ(buffer.capacity(), capacity);
+  ASSERT_EQ(buffer.front(), "992");
+  ASSERT_EQ(buffer.back(), "999");
+  buffer.clear();
+  buffer.push_back("x");
+  ASSERT_EQ(&buffer.front(), data);
+}
+
+TEST(ring_buffer, emplace_own_element) {
+  s21::ring_buffer<std::string> buffer{"a", "b", "c", "d",
+                                       "e", "f", "g", "h"};
+  ASSERT_EQ(buffer.size(), buffer.capacity());
+  buffer.push_back(buffer.front());
+  buffer.push_front(buffer.back());
+  std::deque<std::string> expected{"a", "a", "b", "c", "d",
+                                   "e", "f", "g", "h", "a"};
+  ASSERT_TRUE(SameElements(buffer, expected));
+  ASSERT_EQ(buffer.emplace_back(3, 'z'), "zzz");
+  ASSERT_EQ(buffer.emplace_front("y"), "y");
+}
+
+TEST(ring_buffer, copy_move_swap_reserve) {
+  s21::ring_buffer<int> a{1, 2, 3};
+  a.push_front(0);
+  s21::ring_buffer<int> b(a);
+  ASSERT_TRUE(SameElements(b, {0, 1, 2, 3}));
+  s21::ring_buffer<int> c(std::move(b));
+  ASSERT_TRUE(b.empty());
+  ASSERT_TRUE(SameElements(c, {0, 1, 2, 3}));
+  b = c;
+  b.push_back(4);
+  c.swap(b);
+  ASSERT_TRUE(SameElements(c, {0, 1, 2, 3, 4}));
+  ASSERT_TRUE(SameElements(b, {0, 1, 2, 3}));
+  a = std::move(c);
+  ASSERT_EQ(a.size(), 5U);
+  a.reserve(100);
+  ASSERT_EQ(a.capacity(), 128U);
+  ASSERT_TRUE(SameElements(a, {0, 1, 2, 3, 4}));
+  ASSERT_THROW(a.reserve(a.max_size() + 1), std::length_error);
+}
+
+TEST(ring_buffer, adaptors_keep_order) {
+  s21::queue<std::string> queue;
+  s21::stack<std::string> stack;
+  for (int i = 0; i < 100; i++) {
+    queue.push(std::to_string(i));
+    stack.push(std::to_string(i));
+    if (i % 2) {
+      queue.pop();
+      stack.pop();
+    }
+  }
+  ASSERT_EQ(queue.size(), 50U);
+  ASSERT_EQ(queue.front(), "50");
+  ASSERT_EQ(queue.back(), "99");
+  ASSERT_EQ(stack.size(), 50U);
+  ASSERT_EQ(stack.top(), "98");
+}
@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <iterator>
+#include <random>
 #include <set>
+#include <vector>
 
 #include "../set/s21_set.h"
 
@@ -14,6 +18,21 @@ bool SetsEqual(s21::Set<int> S1, std::set<int> S2) {
   return true;
 }
 
+int CheckAvl(TreeNode<int, int>* node, TreeNode<int, int>* parent) {
+  if (!node) return 0;
+  if (node->parent != parent) return -1;
+  int l_height = CheckAvl(node->left, node);
+  int r_height = CheckAvl(node->right, node);
+  if (l_height < 0 || r_height < 0 || l_height - r_height > 1 ||
+      r_height - l_height > 1)
+    return -1;
+  size_t size = (node->left ? node->left->size : 0) +
+                (node->right ? node->right->size : 0) + 1;
+  if (node->size != size) return -1;
+  int height = (l_height > r_height ? l_height : r_height) + 1;
+  return node->height == height ? height : -1;
+}
+
 TEST(Set, default_constructor) {
   s21::Set<int> S1;
   std::set<int> S2;
@@ -235,3 +254,196 @@ TEST(Set, max_size) {
   std::set<int> S2 = {1, 2, 3};
   EXPECT_NEAR(S1.max_size() / S2.max_size(), 1, 1);
 }
+
+TEST(Set, avl_invariant) {
+  tree<int, int> T;
+  std::set<int> S;
+  std::mt19937 gen(21);
+  for (int i = 0; i < 20000; i++) {
+    int key = static_cast<int>(gen() % 5000);
+    auto found = T.find(key);
+    if (found == nullptr) {
+      T.insert(key);
+      S.insert(key);
+    } else {
+      T.erase(tree<int, int>::iterator(found.unit));
+      S.erase(key);
+    }
+    if (i % 1000 == 0) {
+      ASSERT_GT(CheckAvl(T.root_, nullptr), 0);
+    }
+  }
+  ASSERT_GT(CheckAvl(T.root_, nullptr), 0);
+  ASSERT_EQ(T.size(), S.size());
+  auto iter1 = T.begin();
+  for (auto iter2 = S.begin(); iter2 != S.end(); ++iter1, ++iter2) {
+    ASSERT_EQ(*iter1, *iter2);
+  }
+  ASSERT_TRUE(iter1 == nullptr);
+}
+
+TEST(Set, sorted_insert_is_logarithmic) {
+  s21::Set<int> S1;
+  for (int i = 0; i < 1000000; i++) S1.insert(i);
+  ASSERT_EQ(S1.size(), 1000000U);
+  ASSERT_EQ(*S1.find(765432), 765432);
+  s21::Set<int> S2(S1);
+  S1.clear();
+  int expected = 0;
+  for (auto iter = S2.begin(); iter != nullptr; ++iter) {
+    ASSERT_EQ(*iter, expected++);
+  }
+}
+
+TEST(Set, range_constructor_sorted) {
+  std::vector<int> keys;
+  for (int i = 0; i < 100000; i++) keys.push_back(i * 2);
+  s21::Set<int> S1(keys.begin(), keys.end());
+  ASSERT_EQ(S1.size(), keys.size());
+  auto iter = S1.begin();
+  for (int key : keys) {
+    ASSERT_EQ(*iter, key);
+    ++iter;
+  }
+  ASSERT_TRUE(S1.contains(199998));
+  ASSERT_FALSE(S1.contains(3));
+}
+
+TEST(Set, range_insert_unsorted_and_duplicates) {
+  s21::Set<int> S1{5, 1, 9};
+  std::set<int> S2{5, 1, 9};
+  std::vector<int> more{7, 3, 9, 3, 0, 12, 5};
+  S1.insert(more.begin(), more.end());
+  S2.insert(more.begin(), more.end());
+  ASSERT_EQ(SetsEqual(S1, S2), true);
+  tree<int, int> T;
+  T.insert(more.begin(), more.end(), true);
+  ASSERT_GT(CheckAvl(T.root_, nullptr), 0);
+  T.insert(0);
+  ASSERT_GT(CheckAvl(T.root_, nullptr), 0);
+}
+
+TEST(Set, merge_large_keeps_duplicates_in_other) {
+  s21::Set<int> S1, S2;
+  std::set<int> S3, S4;
+  for (int i = 0; i < 20000; i++) {
+    S1.insert(i * 2);
+    S3.insert(i * 2);
+    S2.insert(i * 3);
+    S4.insert(i * 3);
+  }
+  S1.merge(S2);
+  S3.merge(S4);
+  ASSERT_TRUE(SetsEqual(S1, S3));
+  ASSERT_TRUE(SetsEqual(S2, S4));
+  s21::Set<int> S5;
+  S5.insert(1);
+  S5.merge(S2);
+  ASSERT_EQ(S5.size(), S4.size() + 1);
+  ASSERT_TRUE(S2.empty());
+}
+
+TEST(Set, set_algebra) {
+  s21::Set<int> S1{1, 3, 5, 7, 9, 11};
+  s21::Set<int> S2{0, 3, 4, 9, 12};
+  std::set<int> A{1, 3, 5, 7, 9, 11}, B{0, 3, 4, 9, 12}, U, I, D;
+  std::set_union(A.begin(), A.end(), B.begin(), B.end(),
+                 std::inserter(U, U.end()));
+  std::set_intersection(A.begin(), A.end(), B.begin(), B.end(),
+                        std::inserter(I, I.end()));
+  std::set_difference(A.begin(), A.end(), B.begin(), B.end(),
+                      std::inserter(D, D.end()));
+
+  s21::Set<int> union_set = set_union(S1, S2);
+  ASSERT_TRUE(SetsEqual(union_set, U));
+  ASSERT_TRUE(SetsEqual(set_intersection(S1, S2), I));
+  ASSERT_TRUE(SetsEqual(set_difference(S1, S2), D));
+  ASSERT_TRUE(SetsEqual(S1, A));
+  ASSERT_TRUE(SetsEqual(S2, B));
+  union_set.insert(100);
+  ASSERT_EQ(union_set.size(), U.size() + 1);
+}
+
+TEST(Set, set_algebra_steals_nodes) {
+  s21::Set<int> S1, S2;
+  std::set<int> A, B, I;
+  for (int i = 0; i < 10000; i++) {
+    S1.insert(i);
+    A.insert(i);
+    S2.insert(i * 7);
+    B.insert(i * 7);
+  }
+  std::set_intersection(A.begin(), A.end(), B.begin(), B.end(),
+                        std::inserter(I, I.end()));
+  s21::Set<int> res = set_intersection(std::move(S1), std::move(S2));
+  ASSERT_TRUE(S1.empty());
+  ASSERT_TRUE(S2.empty());
+  ASSERT_TRUE(SetsEqual(res, I));
+  res.insert(-1);
+  res.erase(res.begin());
+  ASSERT_TRUE(SetsEqual(res, I));
+
+  s21::Set<int> S3{1, 2}, S4{2, 3};
+  ASSERT_TRUE(SetsEqual(set_union(std::move(S3), std::move(S4)), {1, 2, 3}));
+  s21::Set<int> S5{1, 2}, S6{2, 3};
+  ASSERT_TRUE(SetsEqual(set_difference(std::move(S5), std::move(S6)), {1}));
+}
+
+TEST(Set, tree_merge_and_combine_stay_balanced) {
+  tree<int, int> T1, T2;
+  for (int i = 0; i < 3000; i++) {
+    T1.insert(i * 2);
+    T2.insert(i * 3);
+  }
+  T1.merge(T2);
+  ASSERT_GT(CheckAvl(T1.root_, nullptr), 0);
+  ASSERT_GT(CheckAvl(T2.root_, nullptr), 0);
+  ASSERT_EQ(T1.size(), 5000u);
+  ASSERT_EQ(T2.size(), 1000u);
+  tree<int, int> T3 = tree<int, int>::Combine(T1, T2, SetOperation::kUnion);
+  ASSERT_GT(CheckAvl(T3.root_, nullptr), 0);
+  ASSERT_EQ(T3.size(), 5000u);
+  tree<int, int> T4 = tree<int, int>::Combine(
+      std::move(T1), std::move(T2), SetOperation::kDifference);
+  ASSERT_GT(CheckAvl(T4.root_, nullptr), 0);
+  ASSERT_EQ(T4.size(), 4000u);
+}
+
+TEST(Set, bounds_and_range_erase) {
+  s21::Set<int> S1;
+  std::set<int> S2;
+  for (int i = 0; i < 500; i++) {
+    S1.insert(i * 3);
+    S2.insert(i * 3);
+  }
+  for (int key = -1; key < 1505; key += 7) {
+    auto lower = S2.lower_bound(key);
+    auto upper = S2.upper_bound(key);
+    if (lower == S2.end()) {
+      ASSERT_TRUE(S1.lower_bound(key) == nullptr);
+    } else {
+      ASSERT_EQ(*S1.lower_bound(key), *lower);
+    }
+    if (upper == S2.end()) {
+      ASSERT_TRUE(S1.upper_bound(key) == nullptr);
+    } else {
+      ASSERT_EQ(*S1.upper_bound(key), *upper);
+    }
+    ASSERT_EQ(S1.count(key), S2.count(key));
+  }
+  auto range = S1.equal_range(30);
+  ASSERT_EQ(*range.first, 30);
+  ASSERT_EQ(*range.second, 33);
+
+  auto next = S1.erase(S1.lower_bound(100), S1.lower_bound(1000));
+  S2.erase(S2.lower_bound(100), S2.lower_bound(1000));
+  ASSERT_EQ(*next, 1002);
+  ASSERT_TRUE(SetsEqual(S1, S2));
+  tree<int, int> T1;
+  for (int i = 0; i < 1000; i++) T1.insert(i);
+  T1.erase(T1.lower_bound(10), T1.lower_bound(900));
+  ASSERT_GT(CheckAvl(T1.root_, nullptr), 0);
+  ASSERT_EQ(T1.size(), 110u);
+  ASSERT_TRUE(T1.erase(T1.lower_bound(950), T1.end()) == nullptr);
+  ASSERT_EQ(T1.size(), 60u);
+}
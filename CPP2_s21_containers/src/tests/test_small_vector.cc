@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../small_vector/s21_small_vector.h"
+
+template <typename Vector>
+bool IsInline(const Vector& vector) {
+  const char* data = reinterpret_cast<const char*>(vector.data());
+  const char* self = reinterpret_cast<const char*>(&vector);
+  return data >= self && data < self + sizeof(vector);
+}
+
+template <typename Vector, typename T>
+bool SameElements(const Vector& vector, const std::vector<T>& expected) {
+  if (vector.size() != expected.size()) return false;
+  for (size_t i = 0; i < expected.size(); i++) {
+    if (!(vector[i] == expected[i])) return false;
+  }
+  return true;
+}
+
+TEST(small_vector, stays_inline) {
+  static_assert(sizeof(s21::vector<int>) == 3 * sizeof(void*));
+  s21::small_vector<int, 8> vector;
+  ASSERT_TRUE(vector.empty());
+  ASSERT_EQ(vector.capacity(), 8U);
+  for (int i = 0; i < 8; i++) vector.push_back(i);
+  ASSERT_TRUE(IsInline(vector));
+  ASSERT_EQ(vector.capacity(), 8U);
+  vector.insert(vector.cbegin() + 2, 2, 100);
+  ASSERT_FALSE(IsInline(vector));
+  ASSERT_EQ(vector.capacity(), 16U);
+  ASSERT_TRUE(SameElements(vector, std::vector<int>{0, 1, 100, 100, 2, 3, 4,
+                                                    5, 6, 7}));
+  vector.erase(vector.cbegin(), vector.cbegin() + 4);
+  vector.shrink_to_fit();
+  ASSERT_TRUE(IsInline(vector));
+  ASSERT_EQ(vector.capacity(), 8U);
+  ASSERT_TRUE(SameElements(vector, std::vector<int>{2, 3, 4, 5, 6, 7}));
+}
+
+TEST(small_vector, constructors) {
+  s21::small_vector<std::string, 4> small{"a", "b"};
+  s21::small_vector<std::string, 4> large(6, "x");
+  s21::small_vector<std::string, 4> sized(3);
+  ASSERT_TRUE(IsInline(small));
+  ASSERT_FALSE(IsInline(large));
+  ASSERT_TRUE(IsInline(sized));
+  ASSERT_EQ(large.capacity(), 6U);
+  ASSERT_EQ(sized.size(), 3U);
+
+  s21::small_vector<std::string, 4> copy(small);
+  ASSERT_TRUE(IsInline(copy));
+  ASSERT_TRUE(SameElements(copy, std::vector<std::string>{"a", "b"}));
+  s21::small_vector<std::string, 4> moved(std::move(large));
+  ASSERT_FALSE(IsInline(moved));
+  ASSERT_TRUE(IsInline(large));
+  ASSERT_TRUE(large.empty());
+  ASSERT_EQ(large.capacity(), 4U);
+  s21::small_vector<std::string, 4> moved_small(std::move(copy));
+  ASSERT_TRUE(IsInline(moved_small));
+  ASSERT_TRUE(copy.empty());
+  ASSERT_TRUE(SameElements(moved_small, std::vector<std::string>{"a", "b"}));
+}
+
+TEST(small_vector, assignment_and_swap) {
+  s21::small_vector<std::string, 3> small{"one", "two"};
+  s21::small_vector<std::string, 3> large{"a", "b", "c", "d", "e"};
+  small.swap(large);
+  ASSERT_TRUE(SameElements(small, std::vector<std::string>{"a", "b", "c", "d",
+                                                           "e"}));
+  ASSERT_TRUE(SameElements(large, std::vector<std::string>{"one", "two"}));
+  ASSERT_TRUE(IsInline(large));
+
+  s21::small_vector<std::string, 3> target{"old"};
+  target = std::move(large);
+  ASSERT_TRUE(IsInline(target));
+  ASSERT_TRUE(SameElements(target, std::vector<std::string>{"one", "two"}));
+  target = small;
+  ASSERT_EQ(target.size(), 5U);
+  ASSERT_EQ(small.size(), 5U);
+  target = std::move(small);
+  ASSERT_EQ(target.back(), "e");
+  ASSERT_TRUE(small.empty());
+  ASSERT_TRUE(IsInline(small));
+}
+
+TEST(small_vector, grows_like_vector) {
+  s21::small_vector<std::string, 2> vector;
+  std::vector<std::string> std_vector;
+  for (int i = 0; i < 100; i++) {
+    std::string value = std::to_string(i * i);
+    size_t pos = (i * 7) % (vector.size() + 1);
+    vector.emplace(vector.cbegin() + pos, value);
+    std_vector.emplace(std_vector.begin() + pos, value);
+    if (i % 10 == 9) {
+      vector.pop_back();
+      std_vector.pop_back();
+    }
+  }
+  ASSERT_TRUE(SameElements(vector, std_vector));
+  vector.clear();
+  vector.emplace_back("last");
+  vector.shrink_to_fit();
+  ASSERT_TRUE(IsInline(vector));
+  ASSERT_EQ(vector.front(), "last");
+}
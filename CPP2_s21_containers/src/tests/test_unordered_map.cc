@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "../unordered_map/s21_unordered_map.h"
+
+bool UnorderedMapsEqual(s21::unordered_map<int, std::string>& M1,
+                        const std::unordered_map<int, std::string>& M2) {
+  if (M1.size() != M2.size()) return false;
+  for (auto& item : M1) {
+    auto iter = M2.find(item.first);
+    if (iter == M2.end() || iter->second != item.second) return false;
+  }
+  return true;
+}
+
+struct MapStringHash {
+  using is_transparent = void;
+  size_t operator()(std::string_view str) const {
+    return std::hash<std::string_view>()(str);
+  }
+};
+
+TEST(UnorderedMap, insert_and_at) {
+  s21::unordered_map<int, std::string> M1{{1, "one"}, {2, "two"}};
+  ASSERT_EQ(M1.at(1), "one");
+  ASSERT_THROW(M1.at(3), std::out_of_range);
+  ASSERT_TRUE(M1.insert(3, "three").second);
+  ASSERT_FALSE(M1.insert({3, "drei"}).second);
+  ASSERT_EQ(M1.at(3), "three");
+  auto res = M1.insert_or_assign(3, "drei");
+  ASSERT_FALSE(res.second);
+  ASSERT_EQ(res.first->second, "drei");
+  M1[4] = "four";
+  ASSERT_EQ(M1[4], "four");
+  ASSERT_EQ(M1[5], "");
+  ASSERT_EQ(M1.size(), 5u);
+  const s21::unordered_map<int, std::string>& C1 = M1;
+  ASSERT_EQ(C1.at(2), "two");
+  ASSERT_TRUE(C1.find(6) == C1.cend());
+}
+
+TEST(UnorderedMap, random_against_std) {
+  std::mt19937 gen(11);
+  std::uniform_int_distribution<int> key(0, 2000);
+  s21::unordered_map<int, std::string> M1;
+  std::unordered_map<int, std::string> M2;
+  for (int i = 0; i < 50000; i++) {
+    int k = key(gen);
+    switch (gen() % 3) {
+      case 0:
+        M1.insert_or_assign(k, std::to_string(i));
+        M2.insert_or_assign(k, std::to_string(i));
+        break;
+      case 1:
+        ASSERT_EQ(M1.try_emplace(k, "x").second,
+                  M2.try_emplace(k, "x").second);
+        break;
+      default:
+        ASSERT_EQ(M1.erase(k), M2.erase(k));
+    }
+  }
+  ASSERT_TRUE(UnorderedMapsEqual(M1, M2));
+}
+
+TEST(UnorderedMap, merge_and_copy) {
+  s21::unordered_map<int, std::string> M1{{1, "a"}, {2, "b"}};
+  s21::unordered_map<int, std::string> M2{{2, "x"}, {3, "c"}};
+  M1.merge(M2);
+  ASSERT_TRUE(UnorderedMapsEqual(M1, {{1, "a"}, {2, "b"}, {3, "c"}}));
+  ASSERT_TRUE(UnorderedMapsEqual(M2, {{2, "x"}}));
+  s21::unordered_map<int, std::string> M3(M1);
+  M1.clear();
+  ASSERT_TRUE(UnorderedMapsEqual(M3, {{1, "a"}, {2, "b"}, {3, "c"}}));
+  M1.swap(M3);
+  ASSERT_TRUE(M3.empty());
+  ASSERT_EQ(M1.size(), 3u);
+}
+
+TEST(UnorderedMap, heterogeneous_lookup) {
+  s21::unordered_map<std::string, int, MapStringHash, std::equal_to<>> M1{
+      {"a", 1}, {"b", 2}};
+  std::string_view key = "b";
+  ASSERT_TRUE(M1.contains(key));
+  ASSERT_EQ(M1.find(key)->second, 2);
+  ASSERT_TRUE(M1.find(std::string_view("c")) == M1.end());
+}
+
+TEST(UnorderedMap, insert_many_and_erase) {
+  s21::unordered_map<int, std::string> M1;
+  auto res = M1.insert_many(std::pair<const int, std::string>(1, "a"),
+                            std::pair<const int, std::string>(1, "b"));
+  ASSERT_EQ(res.size(), 2u);
+  ASSERT_TRUE(res[0].second);
+  ASSERT_FALSE(res[1].second);
+  ASSERT_EQ(M1.at(1), "a");
+  M1.erase(M1.find(1));
+  ASSERT_TRUE(M1.empty());
+}
@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include "../unordered_set/s21_unordered_set.h"
+
+bool UnorderedSetsEqual(const s21::unordered_set<int>& S1,
+                        const std::unordered_set<int>& S2) {
+  if (S1.size() != S2.size()) return false;
+  size_t n = 0;
+  for (int key : S1) {
+    if (!S2.count(key)) return false;
+    n++;
+  }
+  return n == S2.size();
+}
+
+struct StringHash {
+  using is_transparent = void;
+  size_t operator()(std::string_view str) const {
+    return std::hash<std::string_view>()(str);
+  }
+};
+
+struct StringEqual {
+  using is_transparent = void;
+  bool operator()(std::string_view a, std::string_view b) const {
+    return a == b;
+  }
+};
+
+struct ConstantHash {
+  size_t operator()(int) const { return 42; }
+};
+
+TEST(UnorderedSet, default_constructor) {
+  s21::unordered_set<int> S1;
+  ASSERT_TRUE(S1.empty());
+  ASSERT_EQ(S1.size(), 0u);
+  ASSERT_TRUE(S1.begin() == S1.end());
+  ASSERT_FALSE(S1.contains(1));
+  ASSERT_TRUE(S1.find(1) == S1.end());
+}
+
+TEST(UnorderedSet, list_initialized) {
+  s21::unordered_set<int> S1{1, 2, 3, 2, 1};
+  std::unordered_set<int> S2{1, 2, 3, 2, 1};
+  ASSERT_TRUE(UnorderedSetsEqual(S1, S2));
+}
+
+TEST(UnorderedSet, copy_and_move) {
+  s21::unordered_set<int> S1{1, 2, 3};
+  s21::unordered_set<int> S2(S1);
+  ASSERT_TRUE(UnorderedSetsEqual(S2, {1, 2, 3}));
+  s21::unordered_set<int> S3(std::move(S1));
+  ASSERT_TRUE(S1.empty());
+  ASSERT_TRUE(UnorderedSetsEqual(S3, {1, 2, 3}));
+  S1 = S3;
+  S3.insert(4);
+  ASSERT_TRUE(UnorderedSetsEqual(S1, {1, 2, 3}));
+  S1 = std::move(S3);
+  ASSERT_TRUE(UnorderedSetsEqual(S1, {1, 2, 3, 4}));
+  S1.insert(5);
+  ASSERT_EQ(S1.size(), 5u);
+}
+
+TEST(UnorderedSet, insert_find_erase) {
+  s21::unordered_set<int> S1;
+  auto res = S1.insert(7);
+  ASSERT_TRUE(res.second);
+  ASSERT_EQ(*res.first, 7);
+  res = S1.insert(7);
+  ASSERT_FALSE(res.second);
+  ASSERT_EQ(*res.first, 7);
+  ASSERT_TRUE(S1.contains(7));
+  ASSERT_EQ(S1.count(7), 1u);
+  S1.erase(S1.find(7));
+  ASSERT_FALSE(S1.contains(7));
+  ASSERT_EQ(S1.erase(7), 0u);
+  S1.insert(8);
+  ASSERT_EQ(S1.erase(8), 1u);
+  ASSERT_TRUE(S1.empty());
+}
+
+TEST(UnorderedSet, random_against_std) {
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<int> key(0, 5000);
+  s21::unordered_set<int> S1;
+  std::unordered_set<int> S2;
+  for (int i = 0; i < 100000; i++) {
+    int k = key(gen);
+    if (gen() % 3) {
+      ASSERT_EQ(S1.insert(k).second, S2.insert(k).second);
+    } else {
+      ASSERT_EQ(S1.erase(k), S2.erase(k));
+    }
+    ASSERT_EQ(S1.size(), S2.size());
+  }
+  ASSERT_TRUE(UnorderedSetsEqual(S1, S2));
+  ASSERT_LE(S1.load_factor(), 7.0f / 8);
+}
+
+TEST(UnorderedSet, colliding_hash) {
+  s21::unordered_set<int, ConstantHash> S1;
+  for (int i = 0; i < 300; i++) S1.insert(i);
+  for (int i = 0; i < 300; i += 2) S1.erase(i);
+  ASSERT_EQ(S1.size(), 150u);
+  for (int i = 0; i < 300; i++) ASSERT_EQ(S1.contains(i), i % 2 == 1);
+}
+
+TEST(UnorderedSet, heterogeneous_lookup) {
+  s21::unordered_set<std::string, StringHash, StringEqual> S1{"alpha",
+                                                              "beta"};
+  std::string_view key = "beta";
+  ASSERT_TRUE(S1.contains(key));
+  ASSERT_TRUE(S1.contains("alpha"));
+  ASSERT_FALSE(S1.contains(std::string_view("gamma")));
+  ASSERT_EQ(*S1.find(key), "beta");
+}
+
+TEST(UnorderedSet, merge) {
+  s21::unordered_set<int> S1{1, 2, 3};
+  s21::unordered_set<int> S2{3, 4, 5};
+  std::unordered_set<int> S3{1, 2, 3};
+  std::unordered_set<int> S4{3, 4, 5};
+  S1.merge(S2);
+  S3.merge(S4);
+  ASSERT_TRUE(UnorderedSetsEqual(S1, S3));
+  ASSERT_TRUE(UnorderedSetsEqual(S2, S4));
+}
+
+TEST(UnorderedSet, insert_many_and_range) {
+  s21::unordered_set<int> S1;
+  auto res = S1.insert_many(1, 2, 2, 3);
+  ASSERT_EQ(res.size(), 4u);
+  ASSERT_TRUE(res[0].second);
+  ASSERT_FALSE(res[2].second);
+  ASSERT_EQ(*res[2].first, 2);
+  std::vector<int> keys{3, 4, 5, 5};
+  S1.insert(keys.begin(), keys.end());
+  s21::unordered_set<int> S2(keys.begin(), keys.end());
+  ASSERT_TRUE(UnorderedSetsEqual(S1, {1, 2, 3, 4, 5}));
+  ASSERT_TRUE(UnorderedSetsEqual(S2, {3, 4, 5}));
+}
+
+TEST(UnorderedSet, strings_clear_and_reserve) {
+  s21::unordered_set<std::string> S1;
+  S1.reserve(1000);
+  size_t buckets = S1.bucket_count();
+  for (int i = 0; i < 1000; i++) S1.insert(std::to_string(i));
+  ASSERT_EQ(S1.bucket_count(), buckets);
+  ASSERT_TRUE(S1.contains("999"));
+  S1.clear();
+  ASSERT_TRUE(S1.empty());
+  ASSERT_FALSE(S1.contains("999"));
+  S1.insert("x");
+  ASSERT_EQ(S1.size(), 1u);
+}
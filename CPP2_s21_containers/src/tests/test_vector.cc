@@ -1,5 +1,11 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <type_traits>
+
 #include "../vector/s21_vector.h"
 
 TEST(vector, default_constructor_int) {
@@ -501,3 +507,195 @@ TEST(vector, insert_many_back_1) {
   ASSERT_EQ(vector.size(), std_vector.size());
   ASSERT_EQ(vector.capacity(), std_vector.capacity());
 }
+
+struct NoDefault {
+  explicit NoDefault(int v) : value(v) {}
+  int value;
+};
+
+struct CopyCounter {
+  CopyCounter() = default;
+  CopyCounter(const CopyCounter& other) : copies(other.copies + 1) {}
+  CopyCounter(CopyCounter&& other) noexcept : copies(other.copies) {}
+  CopyCounter& operator=(const CopyCounter& other) {
+    copies = other.copies + 1;
+    return *this;
+  }
+  CopyCounter& operator=(CopyCounter&& other) noexcept {
+    copies = other.copies;
+    return *this;
+  }
+  int copies = 0;
+};
+
+TEST(vector, emplace_back_without_default_constructor) {
+  s21::vector<NoDefault> vector;
+  for (int i = 0; i < 100; i++) ASSERT_EQ(vector.emplace_back(i).value, i);
+  ASSERT_EQ(vector.size(), 100U);
+  ASSERT_EQ(vector.capacity(), 128U);
+  vector.reserve(1000);
+  for (int i = 0; i < 100; i++) ASSERT_EQ(vector[i].value, i);
+}
+
+TEST(vector, growth_moves_elements) {
+  s21::vector<CopyCounter> vector;
+  for (int i = 0; i < 100; i++) vector.emplace_back();
+  vector.push_back(CopyCounter());
+  vector.shrink_to_fit();
+  for (size_t i = 0; i < vector.size(); i++) ASSERT_EQ(vector[i].copies, 0);
+  vector.push_back(vector[0]);
+  ASSERT_EQ(vector[vector.size() - 1].copies, 1);
+}
+
+TEST(vector, push_back_own_element) {
+  s21::vector<std::string> vector{"first", "second"};
+  vector.push_back(vector[0]);
+  vector.insert(vector.begin(), vector[2]);
+  ASSERT_EQ(vector.size(), 4U);
+  ASSERT_EQ(vector[0], "first");
+  ASSERT_EQ(vector[3], "first");
+}
+
+TEST(vector, emplace_string) {
+  s21::vector<std::string> vector;
+  std::vector<std::string> std_vector;
+  for (int i = 0; i < 50; i++) {
+    size_t pos = i % (vector.size() + 1);
+    vector.emplace(vector.cbegin() + pos, i % 7 + 1, 'a' + i % 26);
+    std_vector.emplace(std_vector.begin() + pos, i % 7 + 1, 'a' + i % 26);
+  }
+  std::string moved = "moved";
+  vector.insert(vector.begin() + 3, std::move(moved));
+  std_vector.insert(std_vector.begin() + 3, "moved");
+  ASSERT_EQ(vector.size(), std_vector.size());
+  for (size_t i = 0; i < vector.size(); i++) {
+    ASSERT_EQ(vector[i], std_vector[i]);
+  }
+  vector.erase(vector.begin() + 10);
+  std_vector.erase(std_vector.begin() + 10);
+  vector.resize(20);
+  std_vector.resize(20);
+  for (size_t i = 0; i < vector.size(); i++) {
+    ASSERT_EQ(vector.at(i), std_vector.at(i));
+  }
+}
+
+TEST(vector, move_and_copy_assignment) {
+  s21::vector<std::string> vector{"Hi", "my", "friend"};
+  s21::vector<std::string> result{"old"};
+  result = std::move(vector);
+  ASSERT_EQ(result.size(), 3U);
+  ASSERT_EQ(result[2], "friend");
+  ASSERT_EQ(vector.size(), 0U);
+  ASSERT_EQ(vector.data(), nullptr);
+  s21::vector<std::string> copy{"x"};
+  copy = result;
+  ASSERT_EQ(copy.size(), 3U);
+  ASSERT_EQ(copy[0], "Hi");
+  ASSERT_EQ(result[0], "Hi");
+}
+
+TEST(vector, random_access_iterators) {
+  using Iter = s21::vector<int>::iterator;
+  using ConstIter = s21::vector<int>::const_iterator;
+  static_assert(std::is_same<std::iterator_traits<Iter>::iterator_category,
+                             std::random_access_iterator_tag>::value);
+  static_assert(
+      std::is_same<std::iterator_traits<ConstIter>::reference,
+                   const int&>::value);
+  static_assert(std::is_convertible<Iter, ConstIter>::value);
+  static_assert(!std::is_convertible<ConstIter, Iter>::value);
+
+  s21::vector<int> vector;
+  std::vector<int> std_vector;
+  for (int i = 0; i < 1000; i++) {
+    vector.push_back((i * 7919) % 1000);
+    std_vector.push_back((i * 7919) % 1000);
+  }
+  std::sort(vector.begin(), vector.end());
+  std::sort(std_vector.begin(), std_vector.end());
+  ASSERT_TRUE(std::equal(vector.cbegin(), vector.cend(), std_vector.begin()));
+  ASSERT_EQ(std::distance(vector.begin(), vector.end()), 1000);
+  ASSERT_EQ(*std::lower_bound(vector.cbegin(), vector.cend(), 500), 500);
+
+  Iter iter = vector.begin();
+  iter += 10;
+  ASSERT_EQ(*iter, 10);
+  ASSERT_EQ(iter[5], 15);
+  ASSERT_EQ(*(2 + iter), 12);
+  iter -= 4;
+  ASSERT_EQ(*(iter - 1), 5);
+  ASSERT_TRUE(vector.begin() < iter && iter <= iter && iter > vector.begin());
+  ASSERT_EQ(vector.end() - iter, 994);
+  ConstIter citer = iter;
+  ASSERT_TRUE(citer == vector.cbegin() + 6);
+  ASSERT_TRUE(citer >= vector.cbegin());
+  ASSERT_TRUE(iter == citer && citer == iter);
+  ASSERT_TRUE(vector.begin() < citer && citer > vector.begin());
+  ASSERT_TRUE(vector.begin() != vector.cend() && vector.cend() == vector.end());
+  ASSERT_EQ(citer - vector.begin(), 6);
+  ASSERT_EQ(vector.end() - citer, 994);
+  vector.erase(citer);
+  auto inserted = vector.insert(vector.cbegin(), -1);
+  ASSERT_EQ(*inserted, -1);
+  ASSERT_EQ(vector[7], 7);
+}
+
+template <typename T>
+bool SameVector(const s21::vector<T>& vector, const std::vector<T>& expected) {
+  return vector.size() == expected.size() &&
+         std::equal(vector.cbegin(), vector.cend(), expected.begin());
+}
+
+TEST(vector, range_insert_and_erase) {
+  std::mt19937 gen(3);
+  s21::vector<std::string> vector;
+  std::vector<std::string> std_vector;
+  for (int step = 0; step < 300; step++) {
+    size_t pos = gen() % (vector.size() + 1);
+    size_t count = gen() % 12;
+    if (step % 3 == 0) {
+      std::string value(gen() % 20 + 1, 'a' + step % 26);
+      vector.insert(vector.cbegin() + pos, count, value);
+      std_vector.insert(std_vector.begin() + pos, count, value);
+    } else if (step % 3 == 1) {
+      std::vector<std::string> batch;
+      for (size_t i = 0; i < count; i++) batch.push_back(std::to_string(gen()));
+      auto iter = vector.insert(vector.cbegin() + pos, batch.begin(),
+                                batch.end());
+      std_vector.insert(std_vector.begin() + pos, batch.begin(), batch.end());
+      ASSERT_EQ(iter - vector.begin(), static_cast<ptrdiff_t>(pos));
+    } else {
+      size_t last = pos + std::min(count, vector.size() - pos);
+      auto iter = vector.erase(vector.cbegin() + pos, vector.cbegin() + last);
+      std_vector.erase(std_vector.begin() + pos, std_vector.begin() + last);
+      ASSERT_EQ(iter - vector.begin(), static_cast<ptrdiff_t>(pos));
+    }
+    ASSERT_TRUE(SameVector(vector, std_vector));
+  }
+  vector.erase(vector.cbegin(), vector.cend());
+  ASSERT_TRUE(vector.empty());
+  ASSERT_THROW(vector.erase(vector.cbegin(), vector.cbegin() + 1),
+               std::out_of_range);
+}
+
+TEST(vector, range_insert_trivial) {
+  s21::vector<int> vector{1, 2, 3, 4, 5};
+  std::vector<int> std_vector{1, 2, 3, 4, 5};
+  vector.reserve(100);
+  std::vector<int> batch{10, 11, 12, 13, 14, 15, 16};
+  vector.insert(vector.cbegin() + 2, batch.begin(), batch.end());
+  std_vector.insert(std_vector.begin() + 2, batch.begin(), batch.end());
+  vector.insert(vector.cbegin() + 1, 3, vector[0]);
+  std_vector.insert(std_vector.begin() + 1, 3, std_vector[0]);
+  ASSERT_TRUE(SameVector(vector, std_vector));
+  ASSERT_EQ(vector.capacity(), 100U);
+
+  std::istringstream input("7 8 9");
+  vector.insert(vector.cbegin(), std::istream_iterator<int>(input),
+                std::istream_iterator<int>());
+  std_vector.insert(std_vector.begin(), {7, 8, 9});
+  vector.erase(vector.cbegin() + 4, vector.cbegin() + 9);
+  std_vector.erase(std_vector.begin() + 4, std_vector.begin() + 9);
+  ASSERT_TRUE(SameVector(vector, std_vector));
+}
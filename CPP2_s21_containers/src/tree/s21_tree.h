@@ -1,17 +1,36 @@
 #ifndef CPP2_S21_CONTAINERS_Tree_H_
 #define CPP2_S21_CONTAINERS_Tree_H_
 
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../pool/s21_node_pool.h"
 #include "../vector/s21_vector.h"
 
+// Number of elements a node stands for in the subtree sizes: one, unless
+// a node type holds a run of equal keys, as in s21::counted_tree.
+template <typename Value>
+struct NodeWeight {
+  static size_t Of(const Value&) { return 1; }
+};
+
 template <typename Key, typename value_type>
 class TreeNode {
  public:
   value_type data;
   int height;
+  size_t size;  // elements in this subtree, for nth() and rank()
   TreeNode* left;
   TreeNode* right;
   TreeNode* parent;
   TreeNode(value_type value = value_type());
+  template <typename... Args>
+  explicit TreeNode(std::in_place_t, Args&&... args);
 };
 
 template <typename Key, typename value_type>
@@ -44,6 +63,39 @@ class TreeConstIterator {
   bool operator!=(const TreeConstIterator& other);
 };
 
+// Restricts range overloads to iterator arguments, so that calls such as
+// insert(key, value) never bind to them.
+template <typename It>
+using RequireInputIterator =
+    typename std::iterator_traits<It>::iterator_category;
+
+// The ordered containers compare keys with operator<, as std::less<> does.
+// As with std::map, lookup by another key type K is opt-in: the
+// heterogeneous overloads are enabled only when Compare declares
+// is_transparent, e.g. std::less<>, and K and Key compare both ways, e.g.
+// a string_view or a string literal against std::string keys.
+template <typename Compare, typename Key, typename K, typename = void>
+struct IsTransparentKey : std::false_type {};
+
+template <typename Key, typename K>
+using KeyLessResult =
+    decltype(std::declval<const K&>() < std::declval<const Key&>(),
+             std::declval<const Key&>() < std::declval<const K&>());
+
+template <typename Compare, typename Key, typename K>
+struct IsTransparentKey<
+    Compare, Key, K,
+    std::void_t<typename Compare::is_transparent, KeyLessResult<Key, K>>>
+    : std::bool_constant<!std::is_same<std::decay_t<K>, Key>::value> {};
+
+template <typename Compare, typename Key, typename K>
+using RequireTransparentKey =
+    std::enable_if_t<IsTransparentKey<Compare, Key, K>::value>;
+
+// Selects which elements tree::Combine keeps. Repeated keys follow the
+// std::set_* algorithms: max, min and clamped difference of the counts.
+enum class SetOperation { kUnion, kIntersection, kDifference };
+
 template <typename Key, typename T>
 class tree {
  public:
@@ -57,6 +109,8 @@ class tree {
 
   tree();
   tree(std::initializer_list<value_type> const& items);
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  tree(InputIt first, InputIt last);
   tree(const tree& t);
   tree(tree&& t);
   ~tree();
@@ -74,44 +128,74 @@ class tree {
 
   void clear();
   std::pair<iterator, bool> insert(const value_type& value);
+  std::pair<iterator, bool> insert_unique(const value_type& value);
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> emplace_key(const K& key, Args&&... args);
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  void insert(InputIt first, InputIt last, bool unique = false);
   void erase(iterator pos);
+  iterator erase(iterator first, iterator last);
   void swap(tree& other);
-  void merge(tree& other);
+  void merge(tree& other, bool unique = true);
+  // Set algebra in O(n + m). The rvalue overload reuses the nodes of both
+  // operands instead of copying them and leaves the operands empty.
+  static tree Combine(const tree& a, const tree& b, SetOperation op);
+  static tree Combine(tree&& a, tree&& b, SetOperation op);
 
   const_iterator find(const value_type& key) const;
+  template <typename K>
+  iterator find_key(const K& key) const;
   bool contains(const Key& key);
 
+  // A bound past the last element is null, not end(). Iteration also stops
+  // at nullptr, so [lower_bound(a), upper_bound(b)) is an ordinary range.
+  // Set, Multiset and Map pass the bounds through unchanged.
+  template <typename K>
+  iterator lower_bound(const K& key) const;
+  template <typename K>
+  iterator upper_bound(const K& key) const;
+  template <typename K>
+  size_type count(const K& key) const;
+
+  iterator nth(size_type k) const;
+  template <typename K>
+  size_type rank(const K& key) const;
+
   template <typename... Args>
   s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args);
 
   TreeNode<Key, value_type>* root_;
   TreeNode<Key, value_type>* end_;
   size_type size_;
+  s21::NodePool<TreeNode<Key, value_type>> pool_;
+  static const Key& KeyOf(const value_type& value);
   void Add_End();
+  static void CollectNodes(TreeNode<Key, value_type>* root,
+                           std::vector<TreeNode<Key, value_type>*>& nodes);
+  static void SelectNodes(
+      const std::vector<TreeNode<Key, value_type>*>& a,
+      const std::vector<TreeNode<Key, value_type>*>& b, SetOperation op,
+      std::vector<TreeNode<Key, value_type>*>& taken,
+      std::vector<TreeNode<Key, value_type>*>& dropped);
+  TreeNode<Key, value_type>* Select(size_type& k) const;
+  TreeNode<Key, value_type>* BuildBalanced(TreeNode<Key, value_type>** nodes,
+                                           size_type count,
+                                           TreeNode<Key, value_type>* parent);
   void DelTreeNodeRecursion(TreeNode<Key, value_type>* root);
-  TreeNode<Key, value_type>* DelTreeNode(TreeNode<Key, value_type>* root);
-  void FreeRoot(TreeNode<Key, value_type>*(&root));
-  void CheckParent(TreeNode<Key, value_type>* root_parent,
-                   TreeNode<Key, value_type>*(&root),
-                   TreeNode<Key, value_type>* result);
+  TreeNode<Key, value_type>*& ChildLink(TreeNode<Key, value_type>* node);
+  void RebalanceUp(TreeNode<Key, value_type>* node);
   TreeNode<Key, value_type>* FindMin(TreeNode<Key, value_type>* tmp);
-  int UpdateHeight(TreeNode<Key, value_type>*(&root));
-  int UpdateBalance(TreeNode<Key, value_type>*(&root));
-  void Check();
   TreeNode<Key, value_type>* CopyTree(TreeNode<Key, value_type>* root,
                                       TreeNode<Key, value_type>* parent);
 
   int Height(TreeNode<Key, value_type>* root);
+  static size_type SubtreeSize(TreeNode<Key, value_type>* root);
+  void UpdateNode(TreeNode<Key, value_type>* root);
   void SetBalance(TreeNode<Key, value_type>*(&root));
-  void TurnRight(TreeNode<Key, value_type>*(&root),
-                 TreeNode<Key, value_type>* parent);
-  void TurnLeft(TreeNode<Key, value_type>*(&root),
-                TreeNode<Key, value_type>* parent);
-  void TurnR(TreeNode<Key, value_type>*(&root),
-             TreeNode<Key, value_type>* parent);
-  void TurnL(TreeNode<Key, value_type>*(&root),
-             TreeNode<Key, value_type>* parent);
-  iterator RecursionInsert(TreeNode<Key, value_type>*(&root), value_type value,
+  void TurnR(TreeNode<Key, value_type>*(&root));
+  void TurnL(TreeNode<Key, value_type>*(&root));
+  iterator RecursionInsert(TreeNode<Key, value_type>*(&root),
+                           const value_type& value,
                            TreeNode<Key, value_type>* parent, bool& flag);
 };
 
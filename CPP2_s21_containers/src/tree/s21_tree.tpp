@@ -3,7 +3,22 @@
 
 template <typename Key, typename value_type>
 TreeNode<Key, value_type>::TreeNode(value_type value)
-    : data(value), height(1), left(nullptr), right(nullptr), parent(nullptr) {}
+    : data(value),
+      height(1),
+      size(NodeWeight<value_type>::Of(data)),
+      left(nullptr),
+      right(nullptr),
+      parent(nullptr) {}
+
+template <typename Key, typename value_type>
+template <typename... Args>
+TreeNode<Key, value_type>::TreeNode(std::in_place_t, Args&&... args)
+    : data(std::forward<Args>(args)...),
+      height(1),
+      size(NodeWeight<value_type>::Of(data)),
+      left(nullptr),
+      right(nullptr),
+      parent(nullptr) {}
 
 /////// TreeIterator
 
@@ -28,7 +43,6 @@ TreeIterator<Key, value_type>& TreeIterator<Key, value_type>::operator++() {
   TreeNode<Key, value_type>* tmp = unit;
   if (unit->right) {  // если есть правый потомок,
     tmp = unit->right;
-    tmp->parent = unit;
     while (tmp->left) {  // то ищем там минимальный
       tmp = tmp->left;
     }  // и это будет следующий по величине узел
@@ -110,7 +124,6 @@ TreeConstIterator<Key, value_type>::operator++() {
   TreeNode<Key, value_type>* tmp = unit;
   if (unit->right) {  // если есть правый потомок,
     tmp = unit->right;
-    tmp->parent = unit;
     while (tmp->left) {  // то ищем там минимальный
       tmp = tmp->left;
     }  // и это будет следующий по величине узел
@@ -184,9 +197,13 @@ template <typename Key, typename T>
 tree<Key, T>::tree(std::initializer_list<value_type> const& items) : tree() {
   size_type n = items.size();
   if (n > max_size()) throw "Error max limit";
-  for (size_type i = 0; i < n; i++) {
-    insert(*(items.begin() + i));
-  }
+  insert(items.begin(), items.end());
+}
+
+template <typename Key, typename T>
+template <typename InputIt, typename>
+tree<Key, T>::tree(InputIt first, InputIt last) : tree() {
+  insert(first, last);
 }
 
 template <typename Key, typename T>
@@ -276,7 +293,14 @@ typename tree<Key, T>::size_type tree<Key, T>::max_size() {
 
 template <typename Key, typename T>
 void tree<Key, T>::clear() {
-  DelTreeNodeRecursion(root_);
+  // Trivially destructible nodes need no walk: dropping the slabs frees them.
+  if constexpr (std::is_trivially_destructible<
+                    TreeNode<Key, value_type>>::value) {
+    size_ = 0;
+  } else {
+    DelTreeNodeRecursion(root_);
+  }
+  pool_.release();
   if (end_) delete end_;
   root_ = nullptr;
   end_ = nullptr;
@@ -292,11 +316,132 @@ std::pair<typename tree<Key, T>::iterator, bool> tree<Key, T>::insert(
   return pair;
 }
 
+// Inserts value unless its key is present; returns the element with that
+// key either way.
+template <typename Key, typename T>
+std::pair<typename tree<Key, T>::iterator, bool> tree<Key, T>::insert_unique(
+    const value_type& value) {
+  return emplace_key(KeyOf(value), value);
+}
+
+// Constructs value_type(args...) where key belongs unless key is present.
+// One descent both finds the key and the link to attach the new node to,
+// so nothing is built on a hit.
+template <typename Key, typename T>
+template <typename K, typename... Args>
+std::pair<typename tree<Key, T>::iterator, bool> tree<Key, T>::emplace_key(
+    const K& key, Args&&... args) {
+  TreeNode<Key, value_type>* parent = nullptr;
+  TreeNode<Key, value_type>** link = &root_;
+  while (*link) {
+    parent = *link;
+    if (key < KeyOf(parent->data)) {
+      link = &parent->left;
+    } else if (KeyOf(parent->data) < key) {
+      link = &parent->right;
+    } else {
+      return std::pair<iterator, bool>(iterator(parent), false);
+    }
+  }
+  TreeNode<Key, value_type>* node =
+      pool_.create(std::in_place, std::forward<Args>(args)...);
+  node->parent = parent;
+  *link = node;
+  size_++;
+  RebalanceUp(parent);
+  return std::pair<iterator, bool>(iterator(node), true);
+}
+
+// Bulk insert in O(n + m) when the input is sorted (O(m log m) otherwise):
+// the new nodes are created in one pass, merged with the existing nodes in
+// key order and linked into a perfectly balanced tree. With unique set,
+// keys that are already present, or repeated in the input, are skipped.
+template <typename Key, typename T>
+template <typename InputIt, typename>
+void tree<Key, T>::insert(InputIt first, InputIt last, bool unique) {
+  std::vector<TreeNode<Key, value_type>*> incoming;
+  try {
+    for (; first != last; ++first) incoming.push_back(pool_.create(*first));
+  } catch (...) {
+    for (TreeNode<Key, value_type>* node : incoming) pool_.destroy(node);
+    throw;
+  }
+  if (incoming.empty()) return;
+  auto less = [](TreeNode<Key, value_type>* a, TreeNode<Key, value_type>* b) {
+    return KeyOf(a->data) < KeyOf(b->data);
+  };
+  if (!std::is_sorted(incoming.begin(), incoming.end(), less)) {
+    std::stable_sort(incoming.begin(), incoming.end(), less);
+  }
+  std::vector<TreeNode<Key, value_type>*> existing;
+  existing.reserve(size_);
+  CollectNodes(root_, existing);
+
+  std::vector<TreeNode<Key, value_type>*> nodes;
+  nodes.reserve(existing.size() + incoming.size());
+  size_type i = 0, j = 0;
+  while (i < existing.size() || j < incoming.size()) {
+    // On equal keys the existing node goes first, as with RecursionInsert.
+    TreeNode<Key, value_type>* next =
+        j == incoming.size() ||
+                (i < existing.size() && !less(incoming[j], existing[i]))
+            ? existing[i++]
+            : incoming[j++];
+    if (unique && !nodes.empty() && !less(nodes.back(), next)) {
+      pool_.destroy(next);
+    } else {
+      nodes.push_back(next);
+    }
+  }
+  size_ = nodes.size();
+  root_ = BuildBalanced(nodes.data(), nodes.size(), nullptr);
+}
+
 template <typename Key, typename T>
 void tree<Key, T>::erase(iterator pos) {
-  DelTreeNode(pos.unit);
-  UpdateHeight(root_);
-  UpdateBalance(root_);
+  TreeNode<Key, value_type>* node = pos.unit;
+  if (!node || node == end_) return;
+  TreeNode<Key, value_type>* parent = node->parent;
+  TreeNode<Key, value_type>* rebalance_from = parent;
+  if (node->left && node->right) {
+    // Replace the node with its in-order successor, which has no left child.
+    TreeNode<Key, value_type>* next = FindMin(node->right);
+    rebalance_from = next;
+    if (next->parent != node) {
+      rebalance_from = next->parent;
+      next->parent->left = next->right;
+      if (next->right) next->right->parent = next->parent;
+      next->right = node->right;
+      next->right->parent = next;
+    }
+    next->left = node->left;
+    next->left->parent = next;
+    ChildLink(node) = next;
+    next->parent = parent;
+  } else {
+    TreeNode<Key, value_type>* child = node->left ? node->left : node->right;
+    ChildLink(node) = child;
+    if (child) child->parent = parent;
+  }
+  pool_.destroy(node);
+  size_--;
+  RebalanceUp(rebalance_from);
+}
+
+// Erases [first, last) node by node. Erasing relinks nodes without moving
+// values, so the iterators in between stay valid. end() and the null
+// iterator both mean the end of the tree.
+template <typename Key, typename T>
+typename tree<Key, T>::iterator tree<Key, T>::erase(iterator first,
+                                                    iterator last) {
+  TreeNode<Key, value_type>* stop = last.unit == end_ ? nullptr : last.unit;
+  while (first.unit && first.unit != end_ && first.unit != stop) {
+    iterator next = first;
+    ++next;
+    erase(first);
+    first = next;
+  }
+  return iterator(stop);
 }
 
 template <typename Key, typename T>
@@ -304,27 +449,102 @@ void tree<Key, T>::swap(tree& other) {
   std::swap(this->root_, other.root_);
   std::swap(this->end_, other.end_);
   std::swap(this->size_, other.size_);
+  pool_.swap(other.pool_);
 }
 
+// Moves the nodes of other into this tree in O(n + m): both trees are
+// flattened in key order, merged and relinked as one balanced tree. With
+// unique set, nodes whose key is already present stay in other. Nodes are
+// relinked, not copied; only the ones left behind are copied back into
+// other's pool, since all of other's slabs now belong to this tree.
 template <typename Key, typename T>
-void tree<Key, T>::merge(tree& other) {
+void tree<Key, T>::merge(tree& other, bool unique) {
   if (this == &other) return;
   if (other.root_ == nullptr) return;
   if (root_ == nullptr) {
     swap(other);
-  } else {
-    s21::vector<iterator> pos_to_erase{};
-    iterator iter = other.begin();
-    for (; iter != nullptr; iter++) {
-      if (find(iter.unit->data) == nullptr) {  // для multiset убрать
-        insert(iter.unit->data);
-        pos_to_erase.push_back(iter);
+    return;
+  }
+  std::vector<TreeNode<Key, value_type>*> mine, theirs, nodes, left;
+  mine.reserve(size_);
+  theirs.reserve(other.size_);
+  CollectNodes(root_, mine);
+  CollectNodes(other.root_, theirs);
+  nodes.reserve(mine.size() + theirs.size());
+  auto less = [](TreeNode<Key, value_type>* a, TreeNode<Key, value_type>* b) {
+    return KeyOf(a->data) < KeyOf(b->data);
+  };
+  size_type i = 0, j = 0;
+  while (i < mine.size() || j < theirs.size()) {
+    if (j == theirs.size() ||
+        (i < mine.size() && !less(theirs[j], mine[i]))) {
+      if (unique && j < theirs.size() && !less(mine[i], theirs[j])) {
+        left.push_back(theirs[j++]);
       }
+      nodes.push_back(mine[i++]);
+    } else {
+      nodes.push_back(theirs[j++]);
     }
-    for (size_t i = 0; i < pos_to_erase.size(); i++) {
-      other.erase(pos_to_erase[i]);
+  }
+  pool_.adopt(other.pool_);
+  other.root_ = nullptr;
+  other.size_ = 0;
+  for (TreeNode<Key, value_type>*& node : left) {
+    TreeNode<Key, value_type>* copy = other.pool_.create(node->data);
+    pool_.destroy(node);
+    node = copy;
+  }
+  size_ = nodes.size();
+  root_ = BuildBalanced(nodes.data(), nodes.size(), nullptr);
+  other.size_ = left.size();
+  other.root_ = other.BuildBalanced(left.data(), left.size(), nullptr);
+}
+
+// Union, intersection or difference of a and b in O(n + m). The result is
+// built from copies; a and b are left unchanged.
+template <typename Key, typename T>
+tree<Key, T> tree<Key, T>::Combine(const tree& a, const tree& b,
+                                   SetOperation op) {
+  std::vector<TreeNode<Key, value_type>*> nodes_a, nodes_b, taken, dropped;
+  nodes_a.reserve(a.size_);
+  nodes_b.reserve(b.size_);
+  CollectNodes(a.root_, nodes_a);
+  CollectNodes(b.root_, nodes_b);
+  SelectNodes(nodes_a, nodes_b, op, taken, dropped);
+  tree res;
+  size_type created = 0;
+  try {
+    for (; created < taken.size(); created++) {
+      taken[created] = res.pool_.create(taken[created]->data);
     }
+  } catch (...) {
+    for (size_type i = 0; i < created; i++) res.pool_.destroy(taken[i]);
+    throw;
   }
+  res.size_ = taken.size();
+  res.root_ = res.BuildBalanced(taken.data(), taken.size(), nullptr);
+  return res;
+}
+
+// Same as above, but reuses the nodes of a and b: the result takes over
+// both pools, keeps the selected nodes and destroys the rest. a and b are
+// left empty.
+template <typename Key, typename T>
+tree<Key, T> tree<Key, T>::Combine(tree&& a, tree&& b, SetOperation op) {
+  tree res(std::move(a));
+  std::vector<TreeNode<Key, value_type>*> nodes_a, nodes_b, taken, dropped;
+  nodes_a.reserve(res.size_);
+  nodes_b.reserve(b.size_);
+  CollectNodes(res.root_, nodes_a);
+  CollectNodes(b.root_, nodes_b);
+  SelectNodes(nodes_a, nodes_b, op, taken, dropped);
+  res.pool_.adopt(b.pool_);
+  b.root_ = nullptr;
+  b.size_ = 0;
+  for (TreeNode<Key, value_type>* node : dropped) res.pool_.destroy(node);
+  res.size_ = taken.size();
+  res.root_ = res.BuildBalanced(taken.data(), taken.size(), nullptr);
+  return res;
 }
 
 template <typename Key, typename T>
@@ -344,12 +564,105 @@ typename tree<Key, T>::const_iterator tree<Key, T>::find(
   return nullptr;
 }
 
+template <typename Key, typename T>
+template <typename K>
+typename tree<Key, T>::iterator tree<Key, T>::find_key(const K& key) const {
+  TreeNode<Key, value_type>* tmp = root_;
+  while (tmp) {
+    if (key < KeyOf(tmp->data)) {
+      tmp = tmp->left;
+    } else if (KeyOf(tmp->data) < key) {
+      tmp = tmp->right;
+    } else {
+      return iterator(tmp);
+    }
+  }
+  return nullptr;
+}
+
 template <typename Key, typename T>
 bool tree<Key, T>::contains(const Key& key) {
   if (find(key) != nullptr) return true;
   return false;
 }
 
+// First element whose key is not less than key; null if there is none.
+template <typename Key, typename T>
+template <typename K>
+typename tree<Key, T>::iterator tree<Key, T>::lower_bound(const K& key) const {
+  TreeNode<Key, value_type>* node = root_;
+  TreeNode<Key, value_type>* found = nullptr;
+  while (node) {
+    if (KeyOf(node->data) < key) {
+      node = node->right;
+    } else {
+      found = node;
+      node = node->left;
+    }
+  }
+  return iterator(found);
+}
+
+// First element whose key is greater than key; null if there is none.
+template <typename Key, typename T>
+template <typename K>
+typename tree<Key, T>::iterator tree<Key, T>::upper_bound(const K& key) const {
+  TreeNode<Key, value_type>* node = root_;
+  TreeNode<Key, value_type>* found = nullptr;
+  while (node) {
+    if (key < KeyOf(node->data)) {
+      found = node;
+      node = node->left;
+    } else {
+      node = node->right;
+    }
+  }
+  return iterator(found);
+}
+
+// Counts equal keys in O(log n) from the subtree sizes: the elements not
+// greater than key minus those less than key.
+template <typename Key, typename T>
+template <typename K>
+typename tree<Key, T>::size_type tree<Key, T>::count(const K& key) const {
+  size_type not_greater = 0;
+  TreeNode<Key, value_type>* node = root_;
+  while (node) {
+    if (key < KeyOf(node->data)) {
+      node = node->left;
+    } else {
+      not_greater +=
+          SubtreeSize(node->left) + NodeWeight<value_type>::Of(node->data);
+      node = node->right;
+    }
+  }
+  return not_greater - rank(key);
+}
+
+// The k-th smallest element, counting from 0, found in O(log n) through
+// the subtree sizes.
+template <typename Key, typename T>
+typename tree<Key, T>::iterator tree<Key, T>::nth(size_type k) const {
+  return iterator(Select(k));
+}
+
+// Number of elements whose key is less than key.
+template <typename Key, typename T>
+template <typename K>
+typename tree<Key, T>::size_type tree<Key, T>::rank(const K& key) const {
+  size_type less = 0;
+  TreeNode<Key, value_type>* node = root_;
+  while (node) {
+    if (KeyOf(node->data) < key) {
+      less += SubtreeSize(node->left) + NodeWeight<value_type>::Of(node->data);
+      node = node->right;
+    } else {
+      node = node->left;
+    }
+  }
+  return less;
+}
+
 template <typename Key, typename T>
 template <typename... Args>
 s21::vector<std::pair<typename tree<Key, T>::iterator, bool>>
@@ -374,176 +687,195 @@ void tree<Key, T>::DelTreeNodeRecursion(TreeNode<Key, value_type>* root) {
   if (root) {
     DelTreeNodeRecursion(root->left);
     DelTreeNodeRecursion(root->right);
-    delete root;
+    pool_.destroy(root);
     size_--;
   }
   root = nullptr;
 }
 
 template <typename Key, typename T>
-void tree<Key, T>::TurnR(TreeNode<Key, value_type>*(&root),
-                         TreeNode<Key, value_type>* parent) {
-  TreeNode<Key, value_type>* left_subtree;
-  TreeNode<Key, value_type>* right_subtree_for_left_subtree;
-
-  left_subtree = root->left;
-  left_subtree->parent = parent;
-  right_subtree_for_left_subtree = left_subtree->right;
-
-  left_subtree->right = root;
-  left_subtree->right->parent = left_subtree;
-  root->left = right_subtree_for_left_subtree;
-  root = left_subtree;
-  UpdateHeight(root);
+TreeNode<Key, T>*& tree<Key, T>::ChildLink(TreeNode<Key, T>* node) {
+  if (!node->parent) return root_;
+  return node->parent->left == node ? node->parent->left : node->parent->right;
 }
 
 template <typename Key, typename T>
-void tree<Key, T>::TurnL(TreeNode<Key, value_type>*(&root),
-                         TreeNode<Key, value_type>* parent) {
-  TreeNode<Key, value_type>* right_subtree;
-  TreeNode<Key, value_type>* left_subtree_for_right_subtree;
+void tree<Key, T>::RebalanceUp(TreeNode<Key, value_type>* node) {
+  while (node) {
+    TreeNode<Key, value_type>* parent = node->parent;
+    SetBalance(ChildLink(node));
+    node = parent;
+  }
+}
 
-  right_subtree = root->right;
-  right_subtree->parent = parent;
-  left_subtree_for_right_subtree = right_subtree->left;
+template <typename Key, typename T>
+int tree<Key, T>::Height(TreeNode<Key, value_type>* root) {
+  return root ? root->height : 0;
+}
 
-  right_subtree->left = root;
-  right_subtree->left->parent = right_subtree;
-  root->right = left_subtree_for_right_subtree;
-  root = right_subtree;
+template <typename Key, typename T>
+typename tree<Key, T>::size_type tree<Key, T>::SubtreeSize(
+    TreeNode<Key, value_type>* root) {
+  return root ? root->size : 0;
 }
 
+// Recomputes the height and the subtree size of root from its children.
+// Every rotation and relink ends here, so both stay exact.
 template <typename Key, typename T>
-int tree<Key, T>::UpdateHeight(TreeNode<Key, value_type>*(&root)) {
-  if (!root) return 0;
-  int l_height = UpdateHeight(root->left);
-  int r_height = UpdateHeight(root->right);
+void tree<Key, T>::UpdateNode(TreeNode<Key, value_type>* root) {
+  int l_height = Height(root->left);
+  int r_height = Height(root->right);
   root->height = ((l_height > r_height) ? l_height : r_height) + 1;
-  return root->height;
-}
-
-template <typename Key, typename T>
-int tree<Key, T>::UpdateBalance(TreeNode<Key, value_type>*(&root)) {
-  if (!root) return 0;
-  int l_height = UpdateBalance(root->left);
-  int r_height = UpdateBalance(root->right);
-  if (l_height - r_height > 1) {
-    if (UpdateBalance(root->left->right) > UpdateBalance(root->left->left))
-      TurnL(root->left, root);
-    TurnR(root, root->parent);
-  } else if (l_height - r_height < -1) {
-    if (UpdateBalance(root->right->left) > UpdateBalance(root->right->right))
-      TurnR(root->right, root);
-    TurnL(root, root->parent);
-  }
-  UpdateHeight(root);
-  return root->height;
+  root->size = SubtreeSize(root->left) + SubtreeSize(root->right) +
+               NodeWeight<value_type>::Of(root->data);
+}
+
+template <typename Key, typename T>
+void tree<Key, T>::TurnR(TreeNode<Key, value_type>*(&root)) {
+  TreeNode<Key, value_type>* old_root = root;
+  TreeNode<Key, value_type>* left_subtree = old_root->left;
+
+  old_root->left = left_subtree->right;
+  if (old_root->left) old_root->left->parent = old_root;
+  left_subtree->right = old_root;
+  left_subtree->parent = old_root->parent;
+  old_root->parent = left_subtree;
+  root = left_subtree;
+  UpdateNode(old_root);
+  UpdateNode(left_subtree);
 }
 
 template <typename Key, typename T>
-void tree<Key, T>::Check() {
-  UpdateHeight(root_);
-  UpdateBalance(root_);
+void tree<Key, T>::TurnL(TreeNode<Key, value_type>*(&root)) {
+  TreeNode<Key, value_type>* old_root = root;
+  TreeNode<Key, value_type>* right_subtree = old_root->right;
+
+  old_root->right = right_subtree->left;
+  if (old_root->right) old_root->right->parent = old_root;
+  right_subtree->left = old_root;
+  right_subtree->parent = old_root->parent;
+  old_root->parent = right_subtree;
+  root = right_subtree;
+  UpdateNode(old_root);
+  UpdateNode(right_subtree);
+}
+
+// Restores the AVL invariant at a single node whose subtrees are already
+// balanced, with at most two rotations.
+template <typename Key, typename T>
+void tree<Key, T>::SetBalance(TreeNode<Key, value_type>*(&root)) {
+  UpdateNode(root);
+  int balance = Height(root->left) - Height(root->right);
+  if (balance > 1) {
+    if (Height(root->left->right) > Height(root->left->left))
+      TurnL(root->left);
+    TurnR(root);
+  } else if (balance < -1) {
+    if (Height(root->right->left) > Height(root->right->right))
+      TurnR(root->right);
+    TurnL(root);
+  }
 }
 
 template <typename Key, typename T>
 typename tree<Key, T>::iterator tree<Key, T>::RecursionInsert(
-    TreeNode<Key, value_type>*(&root), value_type value,
+    TreeNode<Key, value_type>*(&root), const value_type& value,
     TreeNode<Key, value_type>* parent, bool& flag) {
-  iterator iter = iterator(root);
   if (!root) {
-    root = new TreeNode<Key, value_type>(value);
-    if (!root) throw "bad alloc";
+    root = pool_.create(value);
     root->parent = parent;
     size_++;
     flag = true;
-    iter = iterator(root);
-  } else {
-    if (value < root->data) {
-      flag = false;
-      iter = RecursionInsert(root->left, value, root, flag);
-    } else {
-      flag = false;
-      iter = RecursionInsert(root->right, value, root, flag);
-    }
+    return iterator(root);
   }
-  UpdateHeight(root_);
-  UpdateBalance(root_);
+  iterator iter = value < root->data
+                      ? RecursionInsert(root->left, value, root, flag)
+                      : RecursionInsert(root->right, value, root, flag);
+  SetBalance(root);
   return iter;
 }
 
 template <typename Key, typename T>
-void tree<Key, T>::CheckParent(TreeNode<Key, value_type>* root_parent,
-                               TreeNode<Key, value_type>*(&root),
-                               TreeNode<Key, value_type>* result) {
-  if (root_parent) {
-    root_parent->left == root ? root_parent->left = result
-                              : root_parent->right = result;
-    if (root) FreeRoot(root);
-    if (result) {
-      result->parent = root_parent;
-      root = result;
-    }
-  }
-}
-
-template <typename Key, typename T>
-void tree<Key, T>::FreeRoot(TreeNode<Key, T>*(&root)) {
-  if (root) {
-    delete root;
-    root = nullptr;
+const Key& tree<Key, T>::KeyOf(const value_type& value) {
+  if constexpr (std::is_same<Key, value_type>::value) {
+    return value;
+  } else {
+    return value.first;
   }
 }
 
 template <typename Key, typename T>
-TreeNode<Key, T>* tree<Key, T>::DelTreeNode(TreeNode<Key, T>* root) {
-  if (!root) return nullptr;
-  TreeNode<Key, value_type>* root_left = root->left;
-  TreeNode<Key, value_type>* root_right = root->right;
-  TreeNode<Key, value_type>* root_parent = root->parent;
-
-  if (!root_left && !root_right) {
-    CheckParent(root_parent, root, nullptr);
-    if (!root_parent) {
-      FreeRoot(root);
-      root_ = root_right;
-    }
-    size_--;
-  } else if (!root_left) {
-    CheckParent(root_parent, root, root_right);
-    if (!root_parent) {
-      FreeRoot(root);
-      root_ = root_right;
-      root_->parent = nullptr;
-    }
-    size_--;
-  } else if (!root_right) {
-    CheckParent(root_parent, root, root_left);
-    size_--;
-  } else {
-    TreeNode<Key, value_type>* tmp = FindMin(root->right);
-    if (tmp->parent->left == tmp) {
-      tmp->parent->left = tmp->right;
-    } else if (tmp->parent->right == tmp) {
-      tmp->parent->right = tmp->right;
-    }
-    CheckParent(root_parent, root, tmp);
-    if (tmp->right) tmp->right->parent = tmp->parent;
-    tmp->parent = root_parent;
-    tmp->left = root_left;
-    root_left->parent = tmp;
-    if (root_right != tmp) {
-      tmp->right = root_right;
-      root_right->parent = tmp;
+void tree<Key, T>::CollectNodes(
+    TreeNode<Key, value_type>* root,
+    std::vector<TreeNode<Key, value_type>*>& nodes) {
+  if (!root) return;
+  CollectNodes(root->left, nodes);
+  nodes.push_back(root);
+  CollectNodes(root->right, nodes);
+}
+
+// One merge pass over two sorted node lists, in the manner of the std::set_*
+// algorithms. Kept nodes go to taken in key order; on equal keys the node
+// from a is kept. Every other node goes to dropped.
+template <typename Key, typename T>
+void tree<Key, T>::SelectNodes(
+    const std::vector<TreeNode<Key, value_type>*>& a,
+    const std::vector<TreeNode<Key, value_type>*>& b, SetOperation op,
+    std::vector<TreeNode<Key, value_type>*>& taken,
+    std::vector<TreeNode<Key, value_type>*>& dropped) {
+  bool keep_a = op != SetOperation::kIntersection;
+  bool keep_b = op == SetOperation::kUnion;
+  bool keep_common = op != SetOperation::kDifference;
+  taken.reserve(keep_b ? a.size() + b.size() : a.size());
+  size_type i = 0, j = 0;
+  while (i < a.size() && j < b.size()) {
+    if (KeyOf(a[i]->data) < KeyOf(b[j]->data)) {
+      (keep_a ? taken : dropped).push_back(a[i++]);
+    } else if (KeyOf(b[j]->data) < KeyOf(a[i]->data)) {
+      (keep_b ? taken : dropped).push_back(b[j++]);
+    } else {
+      (keep_common ? taken : dropped).push_back(a[i++]);
+      dropped.push_back(b[j++]);
     }
-    if (!root_parent) {
-      FreeRoot(root);
-      root_ = tmp;
+  }
+  for (; i < a.size(); i++) (keep_a ? taken : dropped).push_back(a[i]);
+  for (; j < b.size(); j++) (keep_b ? taken : dropped).push_back(b[j]);
+}
+
+// Links nodes, already in key order, into a perfectly balanced subtree.
+template <typename Key, typename T>
+TreeNode<Key, T>* tree<Key, T>::BuildBalanced(
+    TreeNode<Key, value_type>** nodes, size_type count,
+    TreeNode<Key, value_type>* parent) {
+  if (!count) return nullptr;
+  size_type mid = count / 2;
+  TreeNode<Key, value_type>* root = nodes[mid];
+  root->parent = parent;
+  root->left = BuildBalanced(nodes, mid, root);
+  root->right = BuildBalanced(nodes + mid + 1, count - mid - 1, root);
+  UpdateNode(root);
+  return root;
+}
+
+// The node holding the k-th element. k is left as the position of that
+// element within the node, always 0 unless nodes weigh more than one.
+template <typename Key, typename T>
+TreeNode<Key, T>* tree<Key, T>::Select(size_type& k) const {
+  if (k >= SubtreeSize(root_)) throw std::out_of_range("Index out of range");
+  TreeNode<Key, value_type>* node = root_;
+  for (;;) {
+    size_type left = SubtreeSize(node->left);
+    size_type weight = NodeWeight<value_type>::Of(node->data);
+    if (k < left) {
+      node = node->left;
+    } else if (k < left + weight) {
+      k -= left;
+      return node;
+    } else {
+      k -= left + weight;
+      node = node->right;
     }
-    root = tmp;
-    size_--;
   }
-  return root_;
 }
 
 template <typename Key, typename T>
@@ -562,11 +894,12 @@ template <typename Key, typename T>
 TreeNode<Key, T>* tree<Key, T>::CopyTree(TreeNode<Key, T>* root,
                                          TreeNode<Key, T>* parent) {
   if (!root) return nullptr;
-  TreeNode<Key, T>* new_TreeNode = new TreeNode<Key, T>(root->data);
-  if (!new_TreeNode) throw "bad alloc";
+  TreeNode<Key, T>* new_TreeNode = pool_.create(root->data);
   new_TreeNode->parent = parent;
-  new_TreeNode->left = CopyTree(root->left, root);
-  new_TreeNode->right = CopyTree(root->right, root);
+  new_TreeNode->height = root->height;
+  new_TreeNode->size = root->size;
+  new_TreeNode->left = CopyTree(root->left, new_TreeNode);
+  new_TreeNode->right = CopyTree(root->right, new_TreeNode);
 
   return new_TreeNode;
-}
\ No newline at end of file
+}
@@ -0,0 +1,180 @@
+#ifndef CPP2_S21_CONTAINERS_S21_UNORDERED_MAP_H_
+#define CPP2_S21_CONTAINERS_S21_UNORDERED_MAP_H_
+
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <tuple>
+
+#include "../hash/s21_hash_table.h"
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+// Hash map on an open-addressing table. Lookups that take a template key
+// type are available when Hash and KeyEqual are transparent.
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class unordered_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using iterator = HashIterator<value_type>;
+  using const_iterator = HashIterator<const value_type>;
+  using size_type = size_t;
+
+  unordered_map() : table_() {}
+  explicit unordered_map(size_type bucket_count, const Hash& hash = Hash(),
+                         const KeyEqual& equal = KeyEqual())
+      : table_(bucket_count, hash, equal) {}
+  unordered_map(std::initializer_list<value_type> const& items)
+      : table_(items.size()) {
+    for (const value_type& item : items) table_.insert(item);
+  }
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  unordered_map(InputIt first, InputIt last) : table_() {
+    insert(first, last);
+  }
+  unordered_map(const unordered_map& other) : table_(other.table_) {}
+  unordered_map(unordered_map&& other) : table_(std::move(other.table_)) {}
+  ~unordered_map() {}
+
+  unordered_map& operator=(unordered_map&& other) {
+    table_ = std::move(other.table_);
+    return *this;
+  }
+
+  unordered_map& operator=(const unordered_map& other) {
+    table_ = other.table_;
+    return *this;
+  }
+
+  T& at(const Key& key) {
+    iterator iter = table_.find(key);
+    if (iter == table_.end()) throw std::out_of_range("Key not found");
+    return iter->second;
+  }
+
+  const T& at(const Key& key) const {
+    const_iterator iter = table_.find(key);
+    if (iter == table_.end()) throw std::out_of_range("Key not found");
+    return iter->second;
+  }
+
+  T& operator[](const Key& key) { return try_emplace(key).first->second; }
+
+  iterator begin() { return table_.begin(); }
+
+  iterator end() { return table_.end(); }
+
+  const_iterator cbegin() const { return table_.begin(); }
+
+  const_iterator cend() const { return table_.end(); }
+
+  bool empty() const { return table_.empty(); }
+
+  size_type size() const { return table_.size(); }
+
+  size_type max_size() const { return table_.max_size(); }
+
+  size_type bucket_count() const { return table_.bucket_count(); }
+
+  float load_factor() const { return table_.load_factor(); }
+
+  hasher hash_function() const { return table_.hash_function(); }
+
+  key_equal key_eq() const { return table_.key_eq(); }
+
+  void reserve(size_type count) { table_.reserve(count); }
+
+  void clear() { table_.clear(); }
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return table_.insert(value);
+  }
+
+  std::pair<iterator, bool> insert(const Key& key, const T& obj) {
+    return table_.emplace_key(key, key, obj);
+  }
+
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  void insert(InputIt first, InputIt last) {
+    if constexpr (std::is_base_of<std::forward_iterator_tag,
+                                  RequireInputIterator<InputIt>>::value) {
+      table_.reserve(size() + std::distance(first, last));
+    }
+    for (; first != last; ++first) table_.insert(*first);
+  }
+
+  std::pair<iterator, bool> insert_or_assign(const Key& key, const T& obj) {
+    std::pair<iterator, bool> res = table_.emplace_key(key, key, obj);
+    if (!res.second) res.first->second = obj;
+    return res;
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+    return table_.emplace_key(
+        key, std::piecewise_construct, std::forward_as_tuple(key),
+        std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args) {
+    return table_.emplace(std::forward<Args>(args)...);
+  }
+
+  void erase(const_iterator pos) { table_.erase(pos); }
+
+  size_type erase(const Key& key) { return table_.erase_key(key); }
+
+  void swap(unordered_map& other) { table_.swap(other.table_); }
+
+  void merge(unordered_map& other) { table_.merge(other.table_); }
+
+  iterator find(const Key& key) { return table_.find(key); }
+
+  const_iterator find(const Key& key) const { return table_.find(key); }
+
+  template <typename K, typename H = Hash,
+            typename = RequireTransparent<H, KeyEqual>>
+  iterator find(const K& key) {
+    return table_.find(key);
+  }
+
+  template <typename K, typename H = Hash,
+            typename = RequireTransparent<H, KeyEqual>>
+  const_iterator find(const K& key) const {
+    return table_.find(key);
+  }
+
+  bool contains(const Key& key) const { return table_.contains(key); }
+
+  template <typename K, typename H = Hash,
+            typename = RequireTransparent<H, KeyEqual>>
+  bool contains(const K& key) const {
+    return table_.contains(key);
+  }
+
+  size_type count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    s21::vector<std::pair<iterator, bool>> my_vector;
+    table_.reserve(size() + sizeof...(Args));
+    (my_vector.push_back(table_.emplace(std::forward<Args>(args))), ...);
+    return my_vector;
+  }
+
+ private:
+  hash_table<Key, value_type, Hash, KeyEqual> table_;
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_UNORDERED_MAP_H_
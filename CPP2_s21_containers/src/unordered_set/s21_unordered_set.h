@@ -0,0 +1,144 @@
+#ifndef CPP2_S21_CONTAINERS_S21_UNORDERED_SET_H_
+#define CPP2_S21_CONTAINERS_S21_UNORDERED_SET_H_
+
+#include <functional>
+#include <initializer_list>
+
+#include "../hash/s21_hash_table.h"
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+// Hash set on an open-addressing table. Lookups that take a template key
+// type are available when Hash and KeyEqual are transparent.
+template <typename Key, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class unordered_set {
+  using Table = hash_table<Key, Key, Hash, KeyEqual>;
+
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+  using iterator = typename Table::const_iterator;
+  using const_iterator = typename Table::const_iterator;
+  using size_type = size_t;
+
+  unordered_set() : table_() {}
+  explicit unordered_set(size_type bucket_count, const Hash& hash = Hash(),
+                         const KeyEqual& equal = KeyEqual())
+      : table_(bucket_count, hash, equal) {}
+  unordered_set(std::initializer_list<value_type> const& items)
+      : table_(items.size()) {
+    for (const value_type& item : items) table_.insert(item);
+  }
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  unordered_set(InputIt first, InputIt last) : table_() {
+    insert(first, last);
+  }
+  unordered_set(const unordered_set& other) : table_(other.table_) {}
+  unordered_set(unordered_set&& other) : table_(std::move(other.table_)) {}
+  ~unordered_set() {}
+
+  unordered_set& operator=(unordered_set&& other) {
+    table_ = std::move(other.table_);
+    return *this;
+  }
+
+  unordered_set& operator=(const unordered_set& other) {
+    table_ = other.table_;
+    return *this;
+  }
+
+  iterator begin() const { return table_.begin(); }
+
+  iterator end() const { return table_.end(); }
+
+  const_iterator cbegin() const { return table_.begin(); }
+
+  const_iterator cend() const { return table_.end(); }
+
+  bool empty() const { return table_.empty(); }
+
+  size_type size() const { return table_.size(); }
+
+  size_type max_size() const { return table_.max_size(); }
+
+  size_type bucket_count() const { return table_.bucket_count(); }
+
+  float load_factor() const { return table_.load_factor(); }
+
+  hasher hash_function() const { return table_.hash_function(); }
+
+  key_equal key_eq() const { return table_.key_eq(); }
+
+  void reserve(size_type count) { table_.reserve(count); }
+
+  void clear() { table_.clear(); }
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return table_.insert(value);
+  }
+
+  std::pair<iterator, bool> insert(value_type&& value) {
+    return table_.insert(std::move(value));
+  }
+
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  void insert(InputIt first, InputIt last) {
+    if constexpr (std::is_base_of<std::forward_iterator_tag,
+                                  RequireInputIterator<InputIt>>::value) {
+      table_.reserve(size() + std::distance(first, last));
+    }
+    for (; first != last; ++first) table_.insert(*first);
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args&&... args) {
+    return table_.emplace(std::forward<Args>(args)...);
+  }
+
+  void erase(iterator pos) { table_.erase(pos); }
+
+  size_type erase(const Key& key) { return table_.erase_key(key); }
+
+  void swap(unordered_set& other) { table_.swap(other.table_); }
+
+  void merge(unordered_set& other) { table_.merge(other.table_); }
+
+  iterator find(const Key& key) const { return table_.find(key); }
+
+  template <typename K, typename H = Hash,
+            typename = RequireTransparent<H, KeyEqual>>
+  iterator find(const K& key) const {
+    return table_.find(key);
+  }
+
+  bool contains(const Key& key) const { return table_.contains(key); }
+
+  template <typename K, typename H = Hash,
+            typename = RequireTransparent<H, KeyEqual>>
+  bool contains(const K& key) const {
+    return table_.contains(key);
+  }
+
+  size_type count(const Key& key) const { return contains(key) ? 1 : 0; }
+
+  template <typename... Args>
+  s21::vector<std::pair<iterator, bool>> insert_many(Args&&... args) {
+    s21::vector<std::pair<iterator, bool>> my_vector;
+    table_.reserve(size() + sizeof...(Args));
+    (my_vector.push_back(table_.emplace(std::forward<Args>(args))), ...);
+    return my_vector;
+  }
+
+ private:
+  Table table_;
+};
+
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_S21_UNORDERED_SET_H_
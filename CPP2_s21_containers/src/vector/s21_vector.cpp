@@ -3,123 +3,164 @@ using namespace std;
 
 namespace s21 {
 
-template <class T>
-vector<T>::vector() {
+template <class T, size_t N>
+vector<T, N>::vector() {
   sz_ = 0;
-  cap_ = 0;
-  this->data_ = nullptr;
+  cap_ = N;
+  this->data_ = this->Inline();
 }
 
-template <class T>
-vector<T>::vector(size_t value) {
+template <class T, size_t N>
+vector<T, N>::vector(size_t value) : vector() {
   if (this->max_size() < value) {
     throw std::out_of_range("Incorrect size");
   }
+  if (value > cap_) {
+    data_ = Allocate(value);
+    cap_ = value;
+  }
+  try {
+    std::uninitialized_value_construct_n(data_, value);
+  } catch (...) {
+    ResetStorage();
+    throw;
+  }
   sz_ = value;
-  cap_ = sz_;
-  this->data_ = new T[cap_]();
 }
 
-template <class T>
-vector<T>::vector(size_t size, T value) {
-  if (this->max_size() < value) {
+template <class T, size_t N>
+vector<T, N>::vector(size_t size, T value) : vector() {
+  if (this->max_size() < size) {
     throw std::out_of_range("Incorrect size");
   }
-  sz_ = size;
-  cap_ = sz_;
-  this->data_ = new T[cap_]();
-  for (size_t i = 0; i < sz_; i++) {
-    data_[i] = value;
+  if (size > cap_) {
+    data_ = Allocate(size);
+    cap_ = size;
+  }
+  try {
+    std::uninitialized_fill_n(data_, size, value);
+  } catch (...) {
+    ResetStorage();
+    throw;
   }
+  sz_ = size;
 }
 
-template <class T>
-vector<T>::vector(std::initializer_list<T> const& items) {
+template <class T, size_t N>
+vector<T, N>::vector(std::initializer_list<T> const& items) : vector() {
+  if (items.size() > cap_) {
+    data_ = Allocate(items.size());
+    cap_ = items.size();
+  }
+  try {
+    std::uninitialized_copy(items.begin(), items.end(), data_);
+  } catch (...) {
+    ResetStorage();
+    throw;
+  }
   sz_ = items.size();
-  cap_ = sz_;
-  data_ = new T[items.size() * 2];
-  std::copy(items.begin(), items.end(), this->data_);
 }
 
-template <class T>
-vector<T>::vector(const vector& other) {
-  sz_ = other.sz_;
-  cap_ = other.cap_;
-  data_ = new T[cap_]();
-  for (size_t i = 0; i < sz_; i++) {
-    data_[i] = other.data_[i];
+template <class T, size_t N>
+vector<T, N>::vector(const vector& other) : vector() {
+  if (other.sz_ > cap_) {
+    data_ = Allocate(other.sz_);
+    cap_ = other.sz_;
+  }
+  try {
+    std::uninitialized_copy(other.data_, other.data_ + other.sz_, data_);
+  } catch (...) {
+    ResetStorage();
+    throw;
   }
+  sz_ = other.sz_;
 }
 
-template <class T>
-vector<T>::vector(vector&& other) noexcept {
-  sz_ = std::exchange(other.sz_, 0);
-  cap_ = std::exchange(other.cap_, 0);
-  data_ = std::exchange(other.data_, nullptr);
+template <class T, size_t N>
+vector<T, N>::vector(vector&& other) noexcept(
+    N == 0 || std::is_nothrow_move_constructible<T>::value)
+    : vector() {
+  TakeElements(other);
 }
 
-template <class T>
-vector<T> &vector<T>::operator=(vector&& other) noexcept {
+template <class T, size_t N>
+vector<T, N>& vector<T, N>::operator=(const vector& other) {
   if (this != &other) {
-    this->sz_ = other.sz_;
-    cap_ = other.cap_;
-    data_ = other.data_;
+    vector tmp(other);
+    swap(tmp);
+  }
+  return *this;
+}
 
-    delete[] other.data_;
-    other.sz_ = 0;
-    other.cap_ = 0;
-    other.data_ = nullptr;
+template <class T, size_t N>
+vector<T, N>& vector<T, N>::operator=(vector&& other) noexcept(
+    N == 0 || std::is_nothrow_move_constructible<T>::value) {
+  if (this != &other) {
+    clear();
+    ResetStorage();
+    TakeElements(other);
   }
 
   return *this;
 }
 
-template <class value_type>
-typename vector<value_type>::iterator vector<value_type>::begin() {
+template <class value_type, size_t N>
+typename vector<value_type, N>::iterator vector<value_type, N>::begin() {
   return iterator(data_);
 }
 
-template <class value_type>
-typename vector<value_type>::iterator vector<value_type>::end() {
+template <class value_type, size_t N>
+typename vector<value_type, N>::iterator vector<value_type, N>::end() {
   return iterator(data_ + sz_);
 }
 
-template <class value_type>
-typename vector<value_type>::const_iterator vector<value_type>::cbegin() const {
+template <class value_type, size_t N>
+typename vector<value_type, N>::const_iterator vector<value_type, N>::cbegin()
+    const {
   return const_iterator(data_);
 }
 
-template <class value_type>
-typename vector<value_type>::const_iterator vector<value_type>::cend() const {
+template <class value_type, size_t N>
+typename vector<value_type, N>::const_iterator vector<value_type, N>::cend()
+    const {
   return const_iterator(data_ + sz_);
 }
 
-template <class value_type>
-typename vector<value_type>::reference vector<value_type>::at(size_t n) {
+template <class value_type, size_t N>
+typename vector<value_type, N>::reference vector<value_type, N>::at(size_t n) {
+  if (n >= sz_) {
+    throw std::out_of_range("AtError: Index out of range");
+  }
+  return data_[n];
+}
+
+template <class value_type, size_t N>
+typename vector<value_type, N>::const_reference vector<value_type, N>::at(
+    size_t n) const {
   if (n >= sz_) {
     throw std::out_of_range("AtError: Index out of range");
   }
   return data_[n];
 }
 
-template <class value_type>
-typename vector<value_type>::const_reference vector<value_type>::front() {
+template <class value_type, size_t N>
+typename vector<value_type, N>::const_reference vector<value_type, N>::front() {
   if (this->empty()) {
     throw std::out_of_range("Out of range");
   }
   return *data_;
 }
 
-template <class value_type>
-typename vector<value_type>::const_reference vector<value_type>::back() {
+template <class value_type, size_t N>
+typename vector<value_type, N>::const_reference vector<value_type, N>::back() {
   if (this->empty()) {
     throw std::out_of_range("Out of range");
   }
   return data_[sz_ - 1];
 }
 
-template <class value_type>
-typename vector<value_type>::reference vector<value_type>::operator[](
+template <class value_type, size_t N>
+typename vector<value_type, N>::reference vector<value_type, N>::operator[](
     size_t x) {
   if (this->size() < x) {
     throw std::out_of_range("Index out of range");
@@ -127,147 +168,405 @@ typename vector<value_type>::reference vector<value_type>::operator[](
   return data_[x];
 }
 
-template <class value_type>
-typename vector<value_type>::const_reference vector<value_type>::operator[](
-    size_t x) const {
+template <class value_type, size_t N>
+typename vector<value_type, N>::const_reference
+vector<value_type, N>::operator[](size_t x) const {
   if (this->size() < x) {
     throw std::out_of_range("Index out of range");
   }
   return data_[x];
-}   
+}
 
-template <class T>
-vector<T>::~vector() {
+template <class T, size_t N>
+vector<T, N>::~vector() {
+  std::destroy_n(data_, sz_);
+  Deallocate(data_, cap_);
   sz_ = 0;
   cap_ = 0;
-  delete[] data_;
   data_ = nullptr;
 }
 
-template <class T>
-void vector<T>::clear() {
+template <class T, size_t N>
+void vector<T, N>::clear() {
+  std::destroy_n(data_, sz_);
   sz_ = 0;
 }
 
-template <class T>
-bool vector<T>::empty() {
+template <class T, size_t N>
+bool vector<T, N>::empty() const {
   return sz_ == 0;
 }
 
-template <class T>
-void vector<T>::push_back(const_reference value) {
-  if (sz_ >= cap_) {
-    reserve(sz_ * 2);
-  }
-  if (sz_ == 0) {
-    resize(1);
-    data_[sz_--] = value;
-  }
-  data_[sz_++] = value;
+template <class T, size_t N>
+void vector<T, N>::push_back(const_reference value) {
+  emplace_back(value);
 }
 
-template <class T>
-void vector<T>::pop_back() {
-  this->sz_ > 0 ? this->sz_-- : 0;
+template <class T, size_t N>
+void vector<T, N>::push_back(T&& value) {
+  emplace_back(std::move(value));
 }
 
-template <class T>
-void vector<T>::reserve(size_t new_cap) {
-  if (new_cap < sz_) {
-    new_cap = sz_;
+// On growth the new element is built before the old ones are moved, so
+// args may refer to an element of this vector.
+template <class T, size_t N>
+template <typename... Args>
+typename vector<T, N>::reference vector<T, N>::emplace_back(Args&&... args) {
+  if (sz_ < cap_) {
+    new (data_ + sz_) T(std::forward<Args>(args)...);
+  } else {
+    size_t new_cap = NextCapacity(1);
+    T* ptr = Allocate(new_cap);
+    try {
+      new (ptr + sz_) T(std::forward<Args>(args)...);
+      try {
+        MoveRange(data_, data_ + sz_, ptr);
+      } catch (...) {
+        ptr[sz_].~T();
+        throw;
+      }
+    } catch (...) {
+      Deallocate(ptr, new_cap);
+      throw;
+    }
+    Replace(ptr, new_cap);
   }
-  cap_ = new_cap;
-  T* ptr = new T[cap_];
-  for (size_t i = 0; i < this->sz_; ++i) {
-    ptr[i] = data_[i];
+  return data_[sz_++];
+}
+
+template <class T, size_t N>
+void vector<T, N>::pop_back() {
+  if (sz_ > 0) data_[--sz_].~T();
+}
+
+template <class T, size_t N>
+void vector<T, N>::reserve(size_t new_cap) {
+  if (new_cap <= cap_) return;
+  if (new_cap > max_size()) {
+    throw std::out_of_range("Incorrect size");
   }
-  delete[] data_;
-  data_ = ptr;
+  Reallocate(new_cap);
 }
 
-template <class T>
-void vector<T>::shrink_to_fit() {
-  reserve(sz_);
+template <class T, size_t N>
+void vector<T, N>::shrink_to_fit() {
+  if (cap_ > sz_ && !IsInline()) Reallocate(sz_);
 }
 
-template <class T>
-void vector<T>::resize(size_t new_size) {
+template <class T, size_t N>
+void vector<T, N>::resize(size_t new_size) {
   if (new_size < 1) throw std::out_of_range("Invalid size");
   if (new_size > cap_) {
-    reserve(new_size * 2);
+    reserve(NextCapacity(new_size - sz_));
+  }
+  if (new_size > sz_) {
+    std::uninitialized_value_construct(data_ + sz_, data_ + new_size);
+  } else {
+    std::destroy(data_ + new_size, data_ + sz_);
   }
-
   sz_ = new_size;
 }
 
-template <class T>
-void vector<T>::erase(iterator pos) {
-  size_type position = &(*pos) - data_;
-  size_type zero = 0;
-  if (zero > position || position > sz_) {
+template <class T, size_t N>
+void vector<T, N>::erase(const_iterator pos) {
+  erase(pos, pos + 1);
+}
+
+// The tail is shifted once, by memmove for trivially copyable types.
+template <class T, size_t N>
+typename vector<T, N>::iterator vector<T, N>::erase(const_iterator first,
+                                              const_iterator last) {
+  size_type position = first - cbegin();
+  size_type n = last - first;
+  if (first > last || position > sz_ || n > sz_ - position) {
     throw std::out_of_range("Index out ot range");
   }
-  for (size_type i = position + 1; i < sz_; i++) {
-    data_[i - 1] = data_[i];
+  if (n == 0) return data_ + position;
+  if constexpr (std::is_trivially_copyable<T>::value) {
+    std::memmove(data_ + position, data_ + position + n,
+                 (sz_ - position - n) * sizeof(T));
+  } else {
+    std::move(data_ + position + n, data_ + sz_, data_ + position);
+    std::destroy(data_ + sz_ - n, data_ + sz_);
   }
-  sz_--;
+  sz_ -= n;
+  return data_ + position;
 }
 
-template <typename T>
-void vector<T>::swap(vector<T>& other) {
+// Inline elements cannot trade places by pointer, so they are moved.
+template <typename T, size_t N>
+void vector<T, N>::swap(vector<T, N>& other) {
+  if (this == &other) return;
+  if (IsInline() || other.IsInline()) {
+    vector tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+    return;
+  }
   std::swap(data_, other.data_);
   std::swap(sz_, other.sz_);
   std::swap(cap_, other.cap_);
 }
 
-template <class T>
-typename vector<T>::iterator vector<T>::insert(iterator pos,
+template <class T, size_t N>
+typename vector<T, N>::iterator vector<T, N>::insert(const_iterator pos,
                                                const_reference value) {
-  size_type position = &(*pos) - data_;
-  size_type zero = 0;
-  if (zero > position || position > sz_) {
+  return emplace(pos, value);
+}
+
+template <class T, size_t N>
+typename vector<T, N>::iterator vector<T, N>::insert(const_iterator pos,
+                                               T&& value) {
+  return emplace(pos, std::move(value));
+}
+
+template <class T, size_t N>
+typename vector<T, N>::iterator vector<T, N>::insert(const_iterator pos,
+                                               size_type count,
+                                               const_reference value) {
+  size_type position = pos - cbegin();
+  if (position > sz_) {
     throw std::out_of_range("Index out ot range");
   }
+  const T copy(value);  // value may be an element that the shift moves
+  InsertGap(position, count, [&copy]() -> const T& { return copy; });
+  return data_ + position;
+}
 
-  if (sz_ == cap_) {
-    reserve(cap_ ? cap_ * 2 : 1);
+// The range must not point into this vector. Single-pass input is buffered
+// first, so that the tail is still shifted only once.
+template <class T, size_t N>
+template <typename InputIt, typename>
+typename vector<T, N>::iterator vector<T, N>::insert(const_iterator pos,
+                                               InputIt first, InputIt last) {
+  size_type position = pos - cbegin();
+  if (position > sz_) {
+    throw std::out_of_range("Index out ot range");
+  }
+  using Category = typename std::iterator_traits<InputIt>::iterator_category;
+  if constexpr (std::is_base_of<std::forward_iterator_tag, Category>::value) {
+    size_type n = std::distance(first, last);
+    InsertGap(position, n, [&first]() -> decltype(auto) { return *first++; });
+  } else {
+    vector buffer;
+    for (; first != last; ++first) buffer.emplace_back(*first);
+    T* next = buffer.data_;
+    InsertGap(position, buffer.sz_,
+              [&next]() -> T&& { return std::move(*next++); });
   }
+  return data_ + position;
+}
 
-  value_type replace = data_[position];
-  sz_++;
-  data_[position] = value;
-  for (size_type i = position + 1; i < sz_; ++i) {
-    value_type next = data_[i];
-    data_[i] = replace;
-    replace = next;
+// Without growth the new element is built aside first, so args may refer
+// to an element that the shift moves.
+template <class T, size_t N>
+template <typename... Args>
+typename vector<T, N>::iterator vector<T, N>::emplace(const_iterator pos,
+                                                Args&&... args) {
+  size_type position = pos - cbegin();
+  if (position > sz_) {
+    throw std::out_of_range("Index out ot range");
   }
+  if (sz_ == cap_) {
+    size_t new_cap = NextCapacity(1);
+    T* ptr = Allocate(new_cap);
+    try {
+      new (ptr + position) T(std::forward<Args>(args)...);
+      try {
+        MoveRange(data_, data_ + position, ptr);
+        try {
+          MoveRange(data_ + position, data_ + sz_, ptr + position + 1);
+        } catch (...) {
+          std::destroy_n(ptr, position);
+          throw;
+        }
+      } catch (...) {
+        ptr[position].~T();
+        throw;
+      }
+    } catch (...) {
+      Deallocate(ptr, new_cap);
+      throw;
+    }
+    Replace(ptr, new_cap);
+  } else if (position == sz_) {
+    new (data_ + sz_) T(std::forward<Args>(args)...);
+  } else {
+    T tmp(std::forward<Args>(args)...);
+    new (data_ + sz_) T(std::move(data_[sz_ - 1]));
+    std::move_backward(data_ + position, data_ + sz_ - 1, data_ + sz_);
+    data_[position] = std::move(tmp);
+  }
+  sz_++;
   return data_ + position;
 }
 
-template <class T>
+template <class T, size_t N>
 template <typename... Args>
-typename vector<T>::iterator vector<T>::insert_many(const_iterator pos,
+typename vector<T, N>::iterator vector<T, N>::insert_many(const_iterator pos,
                                                     Args&&... args) {
-  vector<value_type> tmp{args...};
-  iterator cur_pos = begin() + (pos - cbegin());
-  for (size_t i = 0; i < tmp.size(); ++i) {
-    cur_pos = insert(cur_pos, tmp[i]);
-    ++cur_pos;
-  }
-  return cur_pos;
+  vector<value_type, N> tmp{args...};
+  return insert(pos, std::make_move_iterator(tmp.begin()),
+                std::make_move_iterator(tmp.end())) +
+         tmp.size();
 }
 
-template <typename T>
+template <typename T, size_t N>
 template <typename... Args>
-void vector<T>::insert_many_back(Args&&... args) {
+void vector<T, N>::insert_many_back(Args&&... args) {
   insert_many(cend(), args...);
 }
 
-template <typename T>
-void vector<T>::zero() {
+template <typename T, size_t N>
+void vector<T, N>::zero() {
   cap_ = 0;
   sz_ = 0;
   data_ = nullptr;
 }
 
-}  // namespace s21
\ No newline at end of file
+template <class T, size_t N>
+T* vector<T, N>::Allocate(size_t n) {
+  return n ? std::allocator<T>().allocate(n) : nullptr;
+}
+
+template <class T, size_t N>
+void vector<T, N>::Deallocate(T* ptr, size_t n) {
+  if (ptr && !(N > 0 && ptr == this->Inline())) {
+    std::allocator<T>().deallocate(ptr, n);
+  }
+}
+
+// Frees heap storage, if any, and goes back to the inline buffer. The
+// elements must already be destroyed.
+template <class T, size_t N>
+void vector<T, N>::ResetStorage() {
+  Deallocate(data_, cap_);
+  data_ = this->Inline();
+  cap_ = N;
+}
+
+// Takes the elements of other into this empty vector, stealing other's
+// heap storage when it has some.
+template <class T, size_t N>
+void vector<T, N>::TakeElements(vector& other) {
+  if (other.IsInline()) {
+    MoveRange(other.data_, other.data_ + other.sz_, data_);
+    sz_ = other.sz_;
+    other.clear();
+    return;
+  }
+  sz_ = std::exchange(other.sz_, 0);
+  cap_ = std::exchange(other.cap_, N);
+  data_ = std::exchange(other.data_, other.Inline());
+}
+
+// Constructs [first, last) at dst from rvalues when that cannot throw and
+// from copies otherwise. On an exception nothing is left constructed at
+// dst and the source is untouched.
+template <class T, size_t N>
+void vector<T, N>::MoveRange(T* first, T* last, T* dst) {
+  if constexpr (std::is_trivially_copyable<T>::value) {
+    if (first != last) std::memcpy(dst, first, (last - first) * sizeof(T));
+  } else {
+    T* cur = dst;
+    try {
+      for (; first != last; ++first, ++cur) {
+        new (cur) T(std::move_if_noexcept(*first));
+      }
+    } catch (...) {
+      std::destroy(dst, cur);
+      throw;
+    }
+  }
+}
+
+// Grows geometrically: at least doubles, as std::vector does.
+template <class T, size_t N>
+size_t vector<T, N>::NextCapacity(size_t extra) const {
+  if (max_size() - sz_ < extra) {
+    throw std::out_of_range("Incorrect size");
+  }
+  size_t new_cap = sz_ + std::max(sz_, extra);
+  return new_cap < sz_ || new_cap > max_size() ? max_size() : new_cap;
+}
+
+// Takes over storage that already holds the elements.
+template <class T, size_t N>
+void vector<T, N>::Replace(T* ptr, size_t new_cap) {
+  std::destroy_n(data_, sz_);
+  Deallocate(data_, cap_);
+  data_ = ptr;
+  cap_ = new_cap;
+}
+
+// Shrinking to at most N elements moves them back inline.
+template <class T, size_t N>
+void vector<T, N>::Reallocate(size_t new_cap) {
+  if (new_cap < N) new_cap = N;
+  T* ptr = new_cap == N ? this->Inline() : Allocate(new_cap);
+  try {
+    MoveRange(data_, data_ + sz_, ptr);
+  } catch (...) {
+    Deallocate(ptr, new_cap);
+    throw;
+  }
+  Replace(ptr, new_cap);
+}
+
+// Opens n slots at position and fills them in order with next(). The tail
+// moves once: into new storage when the capacity is exceeded, otherwise in
+// place, with memmove for trivially copyable types. Slots that still hold
+// moved-from elements are assigned, the rest are constructed.
+template <class T, size_t N>
+template <typename Next>
+void vector<T, N>::InsertGap(size_t position, size_t n, Next next) {
+  if (n == 0) return;
+  if (n > cap_ - sz_) {
+    size_t new_cap = NextCapacity(n);
+    T* ptr = Allocate(new_cap);
+    size_t built = 0;
+    try {
+      for (; built < n; ++built) new (ptr + position + built) T(next());
+      MoveRange(data_, data_ + position, ptr);
+      try {
+        MoveRange(data_ + position, data_ + sz_, ptr + position + n);
+      } catch (...) {
+        std::destroy_n(ptr, position);
+        throw;
+      }
+    } catch (...) {
+      std::destroy_n(ptr + position, built);
+      Deallocate(ptr, new_cap);
+      throw;
+    }
+    Replace(ptr, new_cap);
+  } else if constexpr (std::is_trivially_copyable<T>::value) {
+    std::memmove(data_ + position + n, data_ + position,
+                 (sz_ - position) * sizeof(T));
+    for (size_t i = 0; i < n; i++) new (data_ + position + i) T(next());
+  } else {
+    // The last `moved` elements land in raw slots past the end.
+    size_t moved = std::min(n, sz_ - position);
+    MoveRange(data_ + sz_ - moved, data_ + sz_, data_ + sz_ + n - moved);
+    std::move_backward(data_ + position, data_ + sz_ - moved,
+                       data_ + sz_ - moved + n);
+    size_t i = 0;
+    try {
+      for (; i < n; i++) {
+        if (position + i < sz_) {
+          data_[position + i] = next();
+        } else {
+          new (data_ + position + i) T(next());
+        }
+      }
+    } catch (...) {
+      // Basic guarantee: the shifted tail is dropped.
+      if (position + i > sz_) std::destroy(data_ + sz_, data_ + position + i);
+      std::destroy(data_ + sz_ + n - moved, data_ + sz_ + n);
+      throw;
+    }
+  }
+  sz_ += n;
+}
+
+}  // namespace s21
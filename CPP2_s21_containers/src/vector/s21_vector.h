@@ -1,24 +1,77 @@
 #ifndef VECTOR_H
 #define VECTOR_H
 
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
 #include <iostream>
+#include <iterator>
 #include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 namespace s21 {
 
+// Restricts range overloads to iterator arguments, so that calls such as
+// insert(pos, count, value) never bind to them.
+template <typename It>
+using RequireInputIterator =
+    typename std::iterator_traits<It>::iterator_category;
+
 template <class T>
 class VectorIterator;
 
 template <class T>
 class VectorConstIterator;
 
+// In-object storage for the first N elements of a vector. Empty for N = 0,
+// so that a plain vector stays three words.
+template <class T, size_t N>
+class VectorInlineStorage {
+ protected:
+  T *Inline() { return reinterpret_cast<T *>(buffer_); }
+
+ private:
+  alignas(T) unsigned char buffer_[N * sizeof(T)];
+};
+
 template <class T>
-class vector {
+class VectorInlineStorage<T, 0> {
+ protected:
+  T *Inline() { return nullptr; }
+};
+
+// Elements live in raw storage: only the first sz_ of the cap_ slots hold
+// constructed objects. Growth moves the elements when their move
+// constructor is noexcept and copies them otherwise, so a throwing copy
+// leaves the vector unchanged.
+//
+// With N > 0 (see small_vector) the first N elements are kept inside the
+// object and the heap is only used past that. Moving such a vector then
+// moves its elements one by one while they are inline.
+template <class T, size_t N = 0>
+class vector : private VectorInlineStorage<T, N> {
  private:
   size_t sz_;
   size_t cap_;
   T *data_;
 
+  bool IsInline() { return N > 0 && data_ == this->Inline(); }
+  void ResetStorage();
+  void TakeElements(vector &other);
+  static T *Allocate(size_t n);
+  void Deallocate(T *ptr, size_t n);
+  static void MoveRange(T *first, T *last, T *dst);
+  size_t NextCapacity(size_t extra) const;
+  void Replace(T *ptr, size_t new_cap);
+  void Reallocate(size_t new_cap);
+  template <typename Next>
+  void InsertGap(size_t position, size_t n, Next next);
+
  public:
   using iterator = VectorIterator<T>;
   using const_iterator = VectorConstIterator<T>;
@@ -33,26 +86,36 @@ class vector {
   vector(size_t size, T value);
   vector(const vector &other);
   vector(std::initializer_list<T> const &items);
-  vector(vector &&other) noexcept;
+  vector(vector &&other) noexcept(
+      N == 0 || std::is_nothrow_move_constructible<T>::value);
   ~vector();
 
-  bool empty();
+  bool empty() const;
 
-  vector &operator=(vector &&other) noexcept;
+  vector &operator=(const vector &other);
+  vector &operator=(vector &&other) noexcept(
+      N == 0 || std::is_nothrow_move_constructible<T>::value);
   reference operator[](size_t x);
   const_reference operator[](size_t x) const;
 
-  iterator insert(iterator pos, const_reference value);
+  iterator insert(const_iterator pos, const_reference value);
+  iterator insert(const_iterator pos, T &&value);
+  iterator insert(const_iterator pos, size_type count, const_reference value);
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last);
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args);
   template <typename... Args>
   iterator insert_many(const_iterator pos, Args &&...args);
   template <typename... Args>
   void insert_many_back(Args &&...args);
 
   reference at(size_t n);
-  const_reference at(size_t n) const { return this->at(n); }
+  const_reference at(size_t n) const;
   const_reference front();
   const_reference back();
   pointer data() { return data_; };
+  const T *data() const { return data_; }
 
   size_type size() const { return sz_; }
   size_type max_size() const {
@@ -60,14 +123,18 @@ class vector {
   }
   size_type capacity() const { return cap_; }
 
-  void erase(iterator pos);
+  void erase(const_iterator pos);
+  iterator erase(const_iterator first, const_iterator last);
   void clear();
   void push_back(const_reference value);
+  void push_back(T &&value);
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
   void pop_back();
   void shrink_to_fit();
   void reserve(size_t new_cap);
   void resize(size_t new_size);
-  void swap(vector<T> &other);
+  void swap(vector &other);
 
   iterator begin();
   iterator end();
@@ -78,21 +145,30 @@ class vector {
   void zero();
 };
 
+// Contiguous random-access iterators: arithmetic and comparisons are plain
+// pointer operations, so std algorithms run in O(1) steps over a vector.
 template <class T>
 class VectorIterator {
-  friend class vector<T>;
+  template <class, size_t>
+  friend class vector;
   friend class VectorConstIterator<T>;
 
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+#if __cplusplus >= 202002L
+  using iterator_concept = std::contiguous_iterator_tag;
+#endif
   using value_type = T;
+  using difference_type = std::ptrdiff_t;
   using pointer = T *;
   using reference = T &;
 
- public:
   VectorIterator() { ptr_ = nullptr; }
   VectorIterator(pointer ptr) { ptr_ = ptr; }
 
-  value_type &operator*() const { return (*ptr_); }
-  pointer operator->() { return ptr_; }
+  reference operator*() const { return (*ptr_); }
+  pointer operator->() const { return ptr_; }
+  reference operator[](difference_type n) const { return ptr_[n]; }
 
   VectorIterator &operator++() {
     ptr_++;
@@ -116,31 +192,74 @@ class VectorIterator {
     return tmp;
   }
 
-  VectorIterator operator+(int value) const {
-    VectorIterator tmp(*this);
-    for (int i = 0; i < value; i++) {
-      tmp++;
-    }
+  VectorIterator &operator+=(difference_type n) {
+    ptr_ += n;
+    return *this;
+  }
 
-    return tmp;
+  VectorIterator &operator-=(difference_type n) {
+    ptr_ -= n;
+    return *this;
   }
 
-  VectorIterator operator-(int value) const {
-    VectorIterator tmp(*this);
-    for (int i = 0; i < value; i++) {
-      tmp--;
-    }
+  VectorIterator operator+(difference_type n) const {
+    return VectorIterator(ptr_ + n);
+  }
 
-    return tmp;
+  VectorIterator operator-(difference_type n) const {
+    return VectorIterator(ptr_ - n);
   }
 
-  ptrdiff_t operator-(const VectorIterator &other) const {
+  friend VectorIterator operator+(difference_type n,
+                                  const VectorIterator &iter) {
+    return iter + n;
+  }
+
+  difference_type operator-(const VectorIterator &other) const {
     return ptr_ - other.ptr_;
   }
 
-  bool operator==(const VectorIterator &other) { return ptr_ == other.ptr_; }
+  bool operator==(const VectorIterator &other) const {
+    return ptr_ == other.ptr_;
+  }
+  bool operator!=(const VectorIterator &other) const {
+    return ptr_ != other.ptr_;
+  }
+  bool operator<(const VectorIterator &other) const {
+    return ptr_ < other.ptr_;
+  }
+  bool operator>(const VectorIterator &other) const {
+    return ptr_ > other.ptr_;
+  }
+  bool operator<=(const VectorIterator &other) const {
+    return ptr_ <= other.ptr_;
+  }
+  bool operator>=(const VectorIterator &other) const {
+    return ptr_ >= other.ptr_;
+  }
 
-  bool operator!=(const VectorIterator &other) { return ptr_ != other.ptr_; }
+  // Mixed operations with const_iterator, as std::vector allows.
+  difference_type operator-(const VectorConstIterator<T> &other) const {
+    return ptr_ - other.ptr_;
+  }
+  bool operator==(const VectorConstIterator<T> &other) const {
+    return ptr_ == other.ptr_;
+  }
+  bool operator!=(const VectorConstIterator<T> &other) const {
+    return ptr_ != other.ptr_;
+  }
+  bool operator<(const VectorConstIterator<T> &other) const {
+    return ptr_ < other.ptr_;
+  }
+  bool operator>(const VectorConstIterator<T> &other) const {
+    return ptr_ > other.ptr_;
+  }
+  bool operator<=(const VectorConstIterator<T> &other) const {
+    return ptr_ <= other.ptr_;
+  }
+  bool operator>=(const VectorConstIterator<T> &other) const {
+    return ptr_ >= other.ptr_;
+  }
 
   operator VectorConstIterator<T>() const {
     return VectorConstIterator<T>(ptr_);
@@ -152,18 +271,26 @@ class VectorIterator {
 
 template <class T>
 class VectorConstIterator {
-  friend class vector<T>;
+  template <class, size_t>
+  friend class vector;
   friend class VectorIterator<T>;
 
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+#if __cplusplus >= 202002L
+  using iterator_concept = std::contiguous_iterator_tag;
+#endif
   using value_type = T;
-  using pointer = T *;
-  using reference = T &;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const T *;
+  using reference = const T &;
 
- public:
   VectorConstIterator() { ptr_ = nullptr; };
   VectorConstIterator(pointer ptr) { ptr_ = ptr; };
-  value_type operator*() const { return (*ptr_); }
-  pointer operator->() { return ptr_; }
+
+  reference operator*() const { return (*ptr_); }
+  pointer operator->() const { return ptr_; }
+  reference operator[](difference_type n) const { return ptr_[n]; }
 
   VectorConstIterator &operator++() {
     ptr_++;
@@ -187,36 +314,73 @@ class VectorConstIterator {
     return tmp;
   }
 
-  bool operator==(const VectorConstIterator &other) {
-    return ptr_ == other.ptr_;
+  VectorConstIterator &operator+=(difference_type n) {
+    ptr_ += n;
+    return *this;
   }
 
-  bool operator!=(const VectorConstIterator &other) {
-    return ptr_ != other.ptr_;
+  VectorConstIterator &operator-=(difference_type n) {
+    ptr_ -= n;
+    return *this;
   }
 
-  VectorConstIterator operator+(int value) const {
-    VectorConstIterator tmp(*this);
-    for (int i = 0; i < value; i++) {
-      tmp++;
-    };
+  VectorConstIterator operator+(difference_type n) const {
+    return VectorConstIterator(ptr_ + n);
+  }
 
-    return tmp;
+  VectorConstIterator operator-(difference_type n) const {
+    return VectorConstIterator(ptr_ - n);
   }
 
-  VectorConstIterator operator-(int value) const {
-    VectorConstIterator tmp(*this);
-    for (int i = 0; i < value; i++) {
-      tmp--;
-    };
-    return tmp;
+  friend VectorConstIterator operator+(difference_type n,
+                                       const VectorConstIterator &iter) {
+    return iter + n;
   }
 
-  ptrdiff_t operator-(const VectorConstIterator &other) const {
+  difference_type operator-(const VectorConstIterator &other) const {
     return ptr_ - other.ptr_;
   }
 
-  operator VectorIterator<T>() const { return VectorIterator<T>(ptr_); }
+  bool operator==(const VectorConstIterator &other) const {
+    return ptr_ == other.ptr_;
+  }
+  bool operator!=(const VectorConstIterator &other) const {
+    return ptr_ != other.ptr_;
+  }
+  bool operator<(const VectorConstIterator &other) const {
+    return ptr_ < other.ptr_;
+  }
+  bool operator>(const VectorConstIterator &other) const {
+    return ptr_ > other.ptr_;
+  }
+  bool operator<=(const VectorConstIterator &other) const {
+    return ptr_ <= other.ptr_;
+  }
+  bool operator>=(const VectorConstIterator &other) const {
+    return ptr_ >= other.ptr_;
+  }
+
+  difference_type operator-(const VectorIterator<T> &other) const {
+    return ptr_ - other.ptr_;
+  }
+  bool operator==(const VectorIterator<T> &other) const {
+    return ptr_ == other.ptr_;
+  }
+  bool operator!=(const VectorIterator<T> &other) const {
+    return ptr_ != other.ptr_;
+  }
+  bool operator<(const VectorIterator<T> &other) const {
+    return ptr_ < other.ptr_;
+  }
+  bool operator>(const VectorIterator<T> &other) const {
+    return ptr_ > other.ptr_;
+  }
+  bool operator<=(const VectorIterator<T> &other) const {
+    return ptr_ <= other.ptr_;
+  }
+  bool operator>=(const VectorIterator<T> &other) const {
+    return ptr_ >= other.ptr_;
+  }
 
  private:
   pointer ptr_;